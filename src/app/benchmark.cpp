@@ -1,19 +1,38 @@
 #include "ies/StdUtil/RequireCpp17.hpp"
 
 #include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <numeric>
 #include <random>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "benchmark/benchmark.h"
 
 #include "ies/Common/AdjacentArrayRange.hxx"
+#include "ies/Common/AdjacentSpanRange.hxx"
 #include "ies/Common/AdjacentVectorRange.hxx"
+#include "ies/Common/Byte.hpp"
+#include "ies/Common/ByteCursor.hxx"
+#include "ies/Common/ByteLayout.hxx"
+#include "ies/Common/ByteSwap.hpp"
 #include "ies/Common/Endian.hxx"
+#include "ies/Common/IntegralRangeBulk.hpp"
+#include "ies/Common/IntegralRangeList.hxx"
+#include "ies/Common/IntegralRangeLookup.hxx"
+#include "ies/Common/IntegralRangeSet.hxx"
+#include "ies/Common/IntegralRangeStride.hxx"
 #include "ies/Common/IntegralRangeUsing.hpp"
+#include "ies/Common/MappedByteArray.hpp"
+#include "ies/Common/ParallelFor.hxx"
+#include "ies/Common/ProductRange.hxx"
 #include "ies/Common/StringTree.hpp"
 
 #include "ies/StdUtil/Find.hxx"
@@ -21,10 +40,17 @@
 #include "ies/StdUtil/IsIn.hxx"
 #include "ies/StdUtil/MapApply.hxx"
 
+#include "ies/String/DelimitedRecordReader.hpp"
+#include "ies/String/FuzzyIndex.hpp"
 #include "ies/String/Levenshtein.hpp"
+#include "ies/String/LevenshteinBatch.hpp"
+#include "ies/String/MultiReplacer.hpp"
 #include "ies/String/RecursiveReplace.hpp"
 #include "ies/String/SplitString.hpp"
 #include "ies/String/SplitStringView.hpp"
+#include "ies/String/StringInterner.hpp"
+#include "ies/String/StringTokenList.hpp"
+#include "ies/String/SubstringSearcher.hpp"
 
 #include "ies/Time/Timer.hpp"
 #include "ies/Time/TimeUtilFormat.hxx"
@@ -104,6 +130,21 @@ const std::string VeryLongString =
     "joi w j o wef0   mjas,89*(vo1j2io (A, y,)(123j , oasidasd )(aisjdjiqwe), )(Q(W)E0qi0kafkomv091123"
 ;
 
+//'' CSV text with quoted fields, embedded delimiters and escaped quotes.
+std::string
+MakeCsvText(int recordCount)
+{
+    std::string csv;
+    for (int i = 0; i<recordCount; ++i)
+    {
+        auto number = std::to_string(i);
+        csv += number+",name_"+number+",\"city, state\",\"say \"\"hi\"\"\","+number+".5,comment text for record "+number+"\n";
+    }
+    return csv;
+}
+
+const std::string CsvText = MakeCsvText(10000);
+
 IES_SMART_ENUM(AlphabetSE, A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, Q, R, S, T, U, V, W, X, Y, Z);
 
 enum class Alphabet
@@ -235,6 +276,53 @@ BENCHMARK_F(Fixture, MakeAdjacentVectorRange_ToValueVector)(benchmark::State &st
     }
 }
 
+//'' sliding window of state.range(0) values over 64K values, uses first and last value of each window.
+std::vector<int>
+MakeWindowValues()
+{
+    std::vector<int> values(1u<<16);
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+
+void
+BM_AdjacentVectorRange_Window(benchmark::State &state)
+{
+    auto values = MakeWindowValues();
+    auto windowSize = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto itVector : ies::MakeAdjacentVectorRange(values, windowSize))
+        {
+            sum += *itVector.front()+*itVector.back();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()-windowSize+1));
+}
+BENCHMARK(BM_AdjacentVectorRange_Window)->RangeMultiplier(4)->Range(2, 256);
+
+void
+BM_AdjacentSpanRange_Window(benchmark::State &state)
+{
+    auto values = MakeWindowValues();
+    auto windowSize = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto window : ies::MakeAdjacentSpanRange(values, windowSize))
+        {
+            sum += window.front()+window.back();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()-windowSize+1));
+}
+BENCHMARK(BM_AdjacentSpanRange_Window)->RangeMultiplier(4)->Range(2, 256);
+
 // NOLINTNEXTLINE(readability-redundant-member-init)
 BENCHMARK_F(Fixture, RawEnumIterate)(benchmark::State &state)
 {
@@ -375,302 +463,1769 @@ BENCHMARK_F(Fixture, StringTree_ConstructAndRemoveLevel)(benchmark::State &state
 }
 
 void
-BM_Timer_Construct(benchmark::State &state)
+BM_ByteArray_ToString(benchmark::State &state)
 {
+    ies::ByteArray byteArray(1024*1024);
+    std::mt19937 generator{42};
+    for (auto &byte : byteArray)
+    {
+        byte = static_cast<ies::Byte>(generator());
+    }
     for (auto _ : state)
     {
         (void)_;
-        ies::Timer timer;
+        benchmark::DoNotOptimize(ies::ToString(byteArray, 3, byteArray.size()));
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(byteArray.size()));
 }
-BENCHMARK(BM_Timer_Construct);
+BENCHMARK(BM_ByteArray_ToString);
 
+template <typename T>
 void
-BM_Timer_ConstructStartAndEnd(benchmark::State &state)
+BM_ToBigEndian_Loop(benchmark::State &state)
 {
+    constexpr std::size_t Count = 1024*1024;
+    ies::ByteArray buffer(Count*sizeof(T), 0x5A);
+    std::vector<T> values(Count);
     for (auto _ : state)
     {
         (void)_;
-        ies::Timer timer;
-        timer.Start("HasNode");
-        timer.End("HasNode");
+        for (std::size_t i = 0; i<Count; ++i)
+        {
+            values[i] = ies::ToBigEndian<T>(buffer.data()+i*sizeof(T));
+        }
+        benchmark::DoNotOptimize(values.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_Timer_ConstructStartAndEnd);
+BENCHMARK_TEMPLATE(BM_ToBigEndian_Loop, uint16_t);
+BENCHMARK_TEMPLATE(BM_ToBigEndian_Loop, uint32_t);
+BENCHMARK_TEMPLATE(BM_ToBigEndian_Loop, double);
 
+template <typename T>
 void
-BM_TimeUtil_CountNs(benchmark::State &state)
+BM_ReadBigEndianArray(benchmark::State &state)
 {
+    constexpr std::size_t Count = 1024*1024;
+    ies::ByteArray buffer(Count*sizeof(T), 0x5A);
+    std::vector<T> values(Count);
     for (auto _ : state)
     {
         (void)_;
-        auto begin = s2Time::Now();
-        auto nsCount = s2Time::CountNs(begin);
-        benchmark::DoNotOptimize(nsCount);
+        ies::ReadBigEndianArray<T>(buffer.data(), values);
+        benchmark::DoNotOptimize(values.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK_TEMPLATE(BM_ReadBigEndianArray, uint16_t);
+BENCHMARK_TEMPLATE(BM_ReadBigEndianArray, uint32_t);
+BENCHMARK_TEMPLATE(BM_ReadBigEndianArray, double);
+
+//'' frames of {uint16 type, uint32 length, uint64 timestamp, double value} in big endian.
+constexpr std::size_t FrameSize = ies::ByteSizeOf<uint16_t, uint32_t, uint64_t, double>;
+
+ies::ByteArray
+MakeFrames(std::size_t frameCount)
+{
+    ies::ByteArray buffer(frameCount*FrameSize);
+    std::mt19937 generator{42};
+    for (auto &byte : buffer)
+    {
+        byte = static_cast<ies::Byte>(generator());
+    }
+    return buffer;
 }
-BENCHMARK(BM_TimeUtil_CountNs);
 
 void
-BM_TimeUtil_CountNsAndFormat(benchmark::State &state)
+BM_ToBigEndian_Frames(benchmark::State &state)
 {
+    auto buffer = MakeFrames(100000);
     for (auto _ : state)
     {
         (void)_;
-        auto begin = s2Time::Now();
-        auto nsCount = s2Time::CountNs(begin);
-        auto format = s2Time::Format<std::chrono::milliseconds>(nsCount);
-        benchmark::DoNotOptimize(format);
+        double sum = 0;
+        std::size_t offset = 0;
+        while (offset<buffer.size())
+        {
+            sum += ies::ToBigEndian<uint16_t>(buffer.data(), offset);
+            sum += ies::ToBigEndian<uint32_t>(buffer.data(), offset);
+            sum += static_cast<double>(ies::ToBigEndian<uint64_t>(buffer.data(), offset));
+            sum += ies::ToBigEndian<double>(buffer.data(), offset);
+        }
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_TimeUtil_CountNsAndFormat);
+BENCHMARK(BM_ToBigEndian_Frames);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, ToBigEndian)(benchmark::State &state)
+void
+BM_ByteReader_Frames(benchmark::State &state)
 {
+    auto buffer = MakeFrames(100000);
     for (auto _ : state)
     {
         (void)_;
-        auto bigEndian = ies::ToBigEndian<uint64_t>(buffer.data());
-        benchmark::DoNotOptimize(bigEndian);
+        double sum = 0;
+        ies::ByteReader reader{buffer};
+        while (!reader.IsEnd())
+        {
+            reader.Require(FrameSize);
+            sum += reader.ReadBigEndianUnchecked<uint16_t>();
+            sum += reader.ReadBigEndianUnchecked<uint32_t>();
+            sum += static_cast<double>(reader.ReadBigEndianUnchecked<uint64_t>());
+            sum += reader.ReadBigEndianUnchecked<double>();
+        }
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
+BENCHMARK(BM_ByteReader_Frames);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, ToLittleEndian)(benchmark::State &state)
+void
+BM_ByteReader_FramesCheckedEach(benchmark::State &state)
 {
+    auto buffer = MakeFrames(100000);
     for (auto _ : state)
     {
         (void)_;
-        auto littleEndian = ies::ToLittleEndian<uint64_t>(buffer.data());
-        benchmark::DoNotOptimize(littleEndian);
+        double sum = 0;
+        ies::ByteReader reader{buffer};
+        while (!reader.IsEnd())
+        {
+            sum += reader.ReadBigEndian<uint16_t>();
+            sum += reader.ReadBigEndian<uint32_t>();
+            sum += static_cast<double>(reader.ReadBigEndian<uint64_t>());
+            sum += reader.ReadBigEndian<double>();
+        }
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
+BENCHMARK(BM_ByteReader_FramesCheckedEach);
+
+struct Frame
+{
+    uint16_t Type;
+    uint32_t Length;
+    uint64_t Timestamp;
+    double Value;
+};
+
+using FrameLayout = ies::ByteLayout<Frame,
+    ies::ByteLayoutField<&Frame::Type>,
+    ies::ByteLayoutField<&Frame::Length>,
+    ies::ByteLayoutField<&Frame::Timestamp>,
+    ies::ByteLayoutField<&Frame::Value>>;
 
 void
-BM_MapIncrementCount(benchmark::State &state)
+BM_ToBigEndian_DecodeFrames(benchmark::State &state)
 {
-    std::map<AlphabetSE, long long> alphabetCounts;
+    auto buffer = MakeFrames(100000);
+    std::vector<Frame> frames(100000);
     for (auto _ : state)
     {
         (void)_;
-        for (auto alphabet : AlphabetSESmartEnum::ToRange())
+        std::size_t offset = 0;
+        for (auto &frame : frames)
         {
-            ies::MapIncrementCount(alphabetCounts, alphabet);
+            frame.Type = ies::ToBigEndian<uint16_t>(buffer.data(), offset);
+            frame.Length = ies::ToBigEndian<uint32_t>(buffer.data(), offset);
+            frame.Timestamp = ies::ToBigEndian<uint64_t>(buffer.data(), offset);
+            frame.Value = ies::ToBigEndian<double>(buffer.data(), offset);
         }
+        benchmark::DoNotOptimize(frames.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_MapIncrementCount);
+BENCHMARK(BM_ToBigEndian_DecodeFrames);
 
 void
-BM_SplitString(benchmark::State &state)
+BM_ByteLayout_DecodeFrames(benchmark::State &state)
 {
+    auto buffer = MakeFrames(100000);
+    std::vector<Frame> frames(100000);
     for (auto _ : state)
     {
         (void)_;
-        auto tokens = ies::SplitString(" ,()", VeryLongString);
+        ies::ByteReader reader{buffer};
+        for (auto &frame : frames)
+        {
+            FrameLayout::Read(reader, frame);
+        }
+        benchmark::DoNotOptimize(frames.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_SplitString);
+BENCHMARK(BM_ByteLayout_DecodeFrames);
 
 void
-BM_SplitStringView(benchmark::State &state)
+BM_ByteLayout_DecodeFrameArray(benchmark::State &state)
 {
+    auto buffer = MakeFrames(100000);
+    std::vector<Frame> frames(100000);
     for (auto _ : state)
     {
         (void)_;
-        auto tokens = ies::SplitStringView(" ,()", VeryLongString);
+        ies::ByteReader reader{buffer};
+        FrameLayout::Read(reader, frames);
+        benchmark::DoNotOptimize(frames.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_SplitStringView);
+BENCHMARK(BM_ByteLayout_DecodeFrameArray);
 
 void
-BM_RecursiveReplace(benchmark::State &state)
+BM_ByteLayout_EncodeFrames(benchmark::State &state)
 {
-    std::string s = "a///////b//c/d//e////";
+    auto buffer = MakeFrames(100000);
+    std::vector<Frame> frames(100000);
+    ies::ByteReader reader{buffer};
+    for (auto &frame : frames)
+    {
+        frame = FrameLayout::Read(reader);
+    }
     for (auto _ : state)
     {
         (void)_;
-        ies::RecursiveReplace(s, "//", "/");
+        ies::ByteWriter writer{buffer};
+        for (auto &frame : frames)
+        {
+            FrameLayout::Write(frame, writer);
+        }
+        benchmark::DoNotOptimize(buffer.data());
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(buffer.size()));
 }
-BENCHMARK(BM_RecursiveReplace);
+BENCHMARK(BM_ByteLayout_EncodeFrames);
 
 void
-BM_DamerauLevenshtein(benchmark::State &state)
+BM_ByteReader_Uleb128(benchmark::State &state)
 {
-    auto otherVeryLongString = "my_"+VeryLongString+"_test";
+    ies::ByteArray buffer(100000*ies::MaxLeb128Size);
+    ies::ByteWriter writer{buffer};
+    std::mt19937_64 generator{42};
+    std::size_t valueCount = 0;
+    for (; valueCount<100000; ++valueCount)
+    {
+        //'' mostly small values like lengths and ids.
+        writer.WriteUleb128(generator()>>(generator()%64));
+    }
+    auto written = writer.GetWritten();
     for (auto _ : state)
     {
         (void)_;
-        ies::DamerauLevenshtein(VeryLongString, otherVeryLongString);
+        std::uint64_t sum = 0;
+        ies::ByteReader reader{written};
+        while (!reader.IsEnd())
+        {
+            sum += reader.ReadUleb128();
+        }
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(valueCount));
+}
+BENCHMARK(BM_ByteReader_Uleb128);
+
+//'' 64MB file in temp directory, written once per process.
+const std::string &
+GetLargeTempFile()
+{
+    static const std::string path = []
+    {
+        auto filePath = (std::filesystem::temp_directory_path()/"ies_benchmark_large.bin").string();
+        std::ofstream file{filePath, std::ios::binary};
+        std::vector<char> block(1024*1024);
+        std::mt19937 generator{42};
+        for (int i = 0; i<64; ++i)
+        {
+            for (auto &c : block)
+            {
+                c = static_cast<char>(generator());
+            }
+            file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        }
+        return filePath;
+    }();
+    return path;
+}
+
+std::uint64_t
+SumBigEndianUInt32(const ies::Byte* data, std::size_t size)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i+4<=size; i += 4)
+    {
+        sum += ies::ToBigEndian<uint32_t>(data+i);
+    }
+    return sum;
 }
-BENCHMARK(BM_DamerauLevenshtein);
 
 void
-BM_IntRange_Construct(benchmark::State &state)
+BM_ReadFileToByteArray(benchmark::State &state)
 {
+    auto &path = GetLargeTempFile();
+    std::size_t size = 0;
     for (auto _ : state)
     {
         (void)_;
-        IntRange irange{0, 1000};
-        benchmark::DoNotOptimize(irange);
+        std::ifstream file{path, std::ios::binary};
+        ies::ByteArray buffer(std::filesystem::file_size(path));
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        benchmark::DoNotOptimize(SumBigEndianUInt32(buffer.data(), buffer.size()));
+        size = buffer.size();
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(size));
 }
-BENCHMARK(BM_IntRange_Construct);
+BENCHMARK(BM_ReadFileToByteArray)->Unit(benchmark::kMillisecond);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_RawLoop_Const)(benchmark::State &state)
+void
+BM_MappedByteArray(benchmark::State &state)
 {
+    auto &path = GetLargeTempFile();
+    std::size_t size = 0;
     for (auto _ : state)
     {
         (void)_;
-        long long sum = 0;
-        for (int i=0; i<1000; ++i)
-        {
-            sum += i;
-        }
-        benchmark::DoNotOptimize(sum);
+        ies::MappedByteArray file{path, ies::MappedAccessHint::Sequential};
+        benchmark::DoNotOptimize(SumBigEndianUInt32(file.data(), file.size()));
+        size = file.size();
     }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(size));
 }
+BENCHMARK(BM_MappedByteArray)->Unit(benchmark::kMillisecond);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_DEFINE_F(Fixture, IntRange_RawLoop_Iterate)(benchmark::State &state)
+void
+BM_Timer_Construct(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        long long sum = 0;
-        for (int i=0; i<state.range(0); ++i)
-        {
-            sum += i;
-        }
-        benchmark::DoNotOptimize(sum);
+        ies::Timer timer;
     }
 }
-BENCHMARK_REGISTER_F(Fixture, IntRange_RawLoop_Iterate)
-->Arg(10)
-->Arg(100)
-->Arg(1000)
-;
+BENCHMARK(BM_Timer_Construct);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_Iterate)(benchmark::State &state)
+void
+BM_Timer_ConstructStartAndEnd(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        long long sum = 0;
-        for (auto i : intRange)
-        {
-            sum += i;
-        }
-        benchmark::DoNotOptimize(sum);
+        ies::Timer timer;
+        timer.Start("HasNode");
+        timer.End("HasNode");
     }
 }
+BENCHMARK(BM_Timer_ConstructStartAndEnd);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_IterateAndConstruct)(benchmark::State &state)
+void
+BM_TimeUtil_CountNs(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        long long sum = 0;
-        for (auto i : IntRange{0, 1000})
-        {
-            sum += i;
-        }
-        benchmark::DoNotOptimize(sum);
+        auto begin = s2Time::Now();
+        auto nsCount = s2Time::CountNs(begin);
+        benchmark::DoNotOptimize(nsCount);
     }
 }
+BENCHMARK(BM_TimeUtil_CountNs);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_IsInRange)(benchmark::State &state)
+void
+BM_TimeUtil_CountNsAndFormat(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto isInRange = intRange.IsInRange(1750);
-        benchmark::DoNotOptimize(isInRange);
+        auto begin = s2Time::Now();
+        auto nsCount = s2Time::CountNs(begin);
+        auto format = s2Time::Format<std::chrono::milliseconds>(nsCount);
+        benchmark::DoNotOptimize(format);
     }
 }
+BENCHMARK(BM_TimeUtil_CountNsAndFormat);
 
 // NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_FindClosest)(benchmark::State &state)
+BENCHMARK_F(Fixture, ToBigEndian)(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto closest = intRange.FindClosest(1750);
-        benchmark::DoNotOptimize(closest);
+        auto bigEndian = ies::ToBigEndian<uint64_t>(buffer.data());
+        benchmark::DoNotOptimize(bigEndian);
     }
 }
 
 // NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_FindDistance)(benchmark::State &state)
+BENCHMARK_F(Fixture, ToLittleEndian)(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto distance = intRange.FindDistance(1750);
-        benchmark::DoNotOptimize(distance);
+        auto littleEndian = ies::ToLittleEndian<uint64_t>(buffer.data());
+        benchmark::DoNotOptimize(littleEndian);
     }
 }
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_Contains)(benchmark::State &state)
+void
+BM_MapIncrementCount(benchmark::State &state)
 {
+    std::map<AlphabetSE, long long> alphabetCounts;
     for (auto _ : state)
     {
         (void)_;
-        auto contains = intRange.Contains(intRange2);
-        benchmark::DoNotOptimize(contains);
+        for (auto alphabet : AlphabetSESmartEnum::ToRange())
+        {
+            ies::MapIncrementCount(alphabetCounts, alphabet);
+        }
     }
 }
+BENCHMARK(BM_MapIncrementCount);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_Overlaps)(benchmark::State &state)
+void
+BM_SplitString(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto overlaps = intRange.Overlaps(intRange2);
-        benchmark::DoNotOptimize(overlaps);
+        auto tokens = ies::SplitString(" ,()", VeryLongString);
     }
 }
+BENCHMARK(BM_SplitString);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, IntRange_Equal)(benchmark::State &state)
+void
+BM_SplitStringView(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto equals = (intRange==intRange2);
-        benchmark::DoNotOptimize(equals);
+        auto tokens = ies::SplitStringView(" ,()", VeryLongString);
     }
 }
+BENCHMARK(BM_SplitStringView);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, Shift)(benchmark::State &state)
+void
+BM_SplitStringTokenList(benchmark::State &state)
 {
     for (auto _ : state)
     {
         (void)_;
-        auto shifted = Shift(intRange, 50);
-        benchmark::DoNotOptimize(shifted);
+        auto tokens = ies::SplitStringTokenList(" ,()", VeryLongString);
     }
 }
+BENCHMARK(BM_SplitStringTokenList);
 
-// NOLINTNEXTLINE(readability-redundant-member-init)
-BENCHMARK_F(Fixture, ToString)(benchmark::State &state)
+void
+BM_SplitStringViewPreserve_Csv(benchmark::State &state)
 {
+    std::vector<std::string_view> column;
     for (auto _ : state)
     {
         (void)_;
-        auto format = ToString(intRange);
-        benchmark::DoNotOptimize(format);
+        column.clear();
+        for (auto line : ies::SplitStringView("\n", CsvText, 10000))
+        {
+            auto fields = ies::SplitStringViewPreserve(",", line, 8);
+            column.emplace_back(fields[2]);
+        }
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(CsvText.size()));
+}
+BENCHMARK(BM_SplitStringViewPreserve_Csv);
+
+void
+BM_DelimitedRecordReader_Csv(benchmark::State &state)
+{
+    ies::DelimitedRecordBatch batch;
+    std::vector<std::string_view> column;
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::DelimitedRecordReader reader{CsvText};
+        while (reader.ReadBatch(batch))
+        {
+            batch.GetColumn(2, column);
+            benchmark::DoNotOptimize(column);
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(CsvText.size()));
+}
+BENCHMARK(BM_DelimitedRecordReader_Csv);
+
+//'' 4MB haystack, needle of range(0) bytes only appears at end.
+std::string
+MakeSubstringHaystack()
+{
+    std::string haystack;
+    while (haystack.size()<4*1024*1024)
+    {
+        haystack += VeryLongString;
+    }
+    return haystack;
+}
+
+const std::string SubstringHaystack = MakeSubstringHaystack();
+
+std::string
+MakeSubstringNeedle(benchmark::State &state)
+{
+    auto needle = VeryLongString.substr(100, static_cast<std::size_t>(state.range(0))-1)+"#";
+    return needle;
+}
+
+void
+BM_StdStringFind_Substring(benchmark::State &state)
+{
+    auto needle = MakeSubstringNeedle(state);
+    auto haystack = SubstringHaystack+needle;
+    for (auto _ : state)
+    {
+        (void)_;
+        benchmark::DoNotOptimize(haystack.find(needle));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(haystack.size()));
+}
+BENCHMARK(BM_StdStringFind_Substring)->Arg(4)->Arg(20)->Arg(64)->Arg(100)->Arg(1000);
+
+void
+BM_FindString_Substring(benchmark::State &state)
+{
+    auto needle = MakeSubstringNeedle(state);
+    auto haystack = SubstringHaystack+needle;
+    for (auto _ : state)
+    {
+        (void)_;
+        benchmark::DoNotOptimize(ies::FindString(haystack, needle));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(haystack.size()));
+}
+BENCHMARK(BM_FindString_Substring)->Arg(4)->Arg(20)->Arg(64)->Arg(100)->Arg(1000);
+
+void
+BM_SubstringSearcher(benchmark::State &state)
+{
+    auto needle = MakeSubstringNeedle(state);
+    auto haystack = SubstringHaystack+needle;
+    const ies::SubstringSearcher searcher{needle};
+    for (auto _ : state)
+    {
+        (void)_;
+        benchmark::DoNotOptimize(searcher.Find(haystack));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(haystack.size()));
+}
+BENCHMARK(BM_SubstringSearcher)->Arg(4)->Arg(20)->Arg(64)->Arg(100)->Arg(1000);
+
+void
+BM_RecursiveReplace(benchmark::State &state)
+{
+    std::string s = "a///////b//c/d//e////";
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::RecursiveReplace(s, "//", "/");
+    }
+}
+BENCHMARK(BM_RecursiveReplace);
+
+void
+BM_RecursiveReplace_Copy(benchmark::State &state)
+{
+    const std::string input = "a///////b//c/d//e////";
+    for (auto _ : state)
+    {
+        (void)_;
+        auto s = input;
+        ies::RecursiveReplace(s, "//", "/");
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(BM_RecursiveReplace_Copy);
+
+//'' many matches in long string, s.replace per match was quadratic.
+void
+BM_RecursiveReplace_Long(benchmark::State &state)
+{
+    std::string input;
+    for (int i = 0; i<state.range(0); ++i)
+    {
+        input += "a///////b//c/d//e////";
+    }
+    for (auto _ : state)
+    {
+        (void)_;
+        auto s = input;
+        ies::RecursiveReplace(s, "//", "/");
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_RecursiveReplace_Long)->Arg(100)->Arg(10000);
+
+void
+BM_MultiReplacer(benchmark::State &state)
+{
+    const std::string input = "a///////b//c/d//e////";
+    const ies::MultiReplacer replacer{{{"//", "/"}}};
+    for (auto _ : state)
+    {
+        (void)_;
+        auto s = replacer.Replace(input);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(BM_MultiReplacer);
+
+//'' 30 rules replacing words of VeryLongString.
+ies::ReplaceRuleList
+MakeWordReplaceRules()
+{
+    ies::ReplaceRuleList rules;
+    std::set<std::string> usedWords;
+    for (auto &word : ies::SplitString(" ,()", VeryLongString))
+    {
+        if (word.size()<3 || !usedWords.insert(word).second)
+        {
+            continue;
+        }
+        rules.emplace_back(word, "#"+std::string(1, static_cast<char>('A'+rules.size()%26)));
+        if (rules.size()==30)
+        {
+            break;
+        }
+    }
+    return rules;
+}
+
+const ies::ReplaceRuleList WordReplaceRules = MakeWordReplaceRules();
+
+void
+BM_RecursiveReplace_Rules(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto s = VeryLongString;
+        for (auto &[from, to] : WordReplaceRules)
+        {
+            ies::RecursiveReplace(s, from, to);
+        }
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(BM_RecursiveReplace_Rules);
+
+void
+BM_MultiReplacer_Rules(benchmark::State &state)
+{
+    const ies::MultiReplacer replacer{WordReplaceRules, ies::MultiReplaceMode::SinglePass};
+    for (auto _ : state)
+    {
+        (void)_;
+        auto s = replacer.Replace(VeryLongString);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(BM_MultiReplacer_Rules);
+
+void
+BM_DamerauLevenshtein(benchmark::State &state)
+{
+    auto otherVeryLongString = "my_"+VeryLongString+"_test";
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::DamerauLevenshtein(VeryLongString, otherVeryLongString);
+    }
+}
+BENCHMARK(BM_DamerauLevenshtein);
+
+//'' name pairs for fuzzy matching.
+const std::vector<std::pair<std::string, std::string>> NamePairs
+{
+    {"AdjacentArrayRange", "AdjacentVectorRange"},
+    {"DamerauLevenshtein", "DamerauLevenstein"},
+    {"IntegralRangeList", "IntegralRnageList"},
+    {"RecursiveReplace", "ReplaceRecursive"},
+    {"SplitStringView", "SplitString"},
+    {"ToBigEndian", "ToLittleEndian"},
+    {"std::string", "std::string_view"},
+    {"benchmark", "performance"},
+};
+
+void
+BM_DamerauLevenshtein_Short(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &[str1, str2] : NamePairs)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshtein(str1, str2));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(NamePairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshtein_Short);
+
+void
+BM_DamerauLevenshtein_Workspace(benchmark::State &state)
+{
+    ies::LevenshteinWorkspace workspace;
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &[str1, str2] : NamePairs)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshtein(str1, str2, workspace));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(NamePairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshtein_Workspace);
+
+//'' multilingual name pairs for fuzzy matching.
+const std::vector<std::pair<std::string, std::string>> Utf8NamePairs
+{
+    {"Caf\u00e9 M\u00fcller", "Cafe Muller"},
+    {"Fran\u00e7ois Truffaut", "Francois Trufaut"},
+    {"\u6771\u4eac\u90fd\u6e0b\u8c37\u533a", "\u6771\u4eac\u90fd\u65b0\u5bbf\u533a"},
+    {"\u5317\u4eac\u5927\u5b66", "\u5317\u4eac\u5927\u5b78"},
+    {"\u041c\u043e\u0441\u043a\u0432\u0430", "\u041c\u0430\u0441\u043a\u0432\u0430"},
+    {"DamerauLevenshtein", "DamerauLevenstein"},
+    {"IntegralRangeList", "IntegralRnageList"},
+    {"benchmark", "performance"},
+};
+
+void
+BM_DamerauLevenshteinUtf8(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &[str1, str2] : Utf8NamePairs)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshteinUtf8(str1, str2));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(Utf8NamePairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshteinUtf8);
+
+//'' byte distance of same pairs, for overhead of decoding.
+void
+BM_DamerauLevenshtein_Utf8Bytes(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &[str1, str2] : Utf8NamePairs)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshtein(str1, str2));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(Utf8NamePairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshtein_Utf8Bytes);
+
+void
+BM_DamerauLevenshteinUtf8_Long(benchmark::State &state)
+{
+    auto otherVeryLongString = "my_"+VeryLongString+"_\u00e9";
+    for (auto _ : state)
+    {
+        (void)_;
+        benchmark::DoNotOptimize(ies::DamerauLevenshteinUtf8(VeryLongString, otherVeryLongString));
+    }
+}
+BENCHMARK(BM_DamerauLevenshteinUtf8_Long);
+
+void
+BM_DamerauLevenshteinBounded(benchmark::State &state)
+{
+    auto otherVeryLongString = "my_"+VeryLongString+"_test";
+    for (auto _ : state)
+    {
+        (void)_;
+        benchmark::DoNotOptimize(ies::DamerauLevenshteinBounded(VeryLongString, otherVeryLongString, 10));
+    }
+}
+BENCHMARK(BM_DamerauLevenshteinBounded);
+
+void
+BM_DamerauLevenshteinBounded_Short(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &[str1, str2] : NamePairs)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshteinBounded(str1, str2, 2));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(NamePairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshteinBounded_Short);
+
+//'' 100000 pairs of random short strings (4~24 characters) with few edits.
+std::pair<std::vector<std::string>, std::vector<ies::StringViewPair>>
+MakeShortStringPairs()
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<std::size_t> sizeDistribution{4, 24};
+    std::uniform_int_distribution<int> charDistribution{0, 25};
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i<100000; ++i)
+    {
+        std::string s;
+        auto size = sizeDistribution(generator);
+        for (std::size_t j = 0; j<size; ++j)
+        {
+            s += static_cast<char>('a'+charDistribution(generator));
+        }
+        auto edited = s;
+        edited[edited.size()/2] = static_cast<char>('a'+charDistribution(generator));
+        std::swap(edited[0], edited[1]);
+        strings.emplace_back(s);
+        strings.emplace_back(edited);
+    }
+    std::vector<ies::StringViewPair> pairs;
+    for (std::size_t i = 0; i<strings.size(); i += 2)
+    {
+        pairs.emplace_back(strings[i], strings[i+1]);
+    }
+    return {std::move(strings), std::move(pairs)};
+}
+
+void
+BM_DamerauLevenshtein_Pairs(benchmark::State &state)
+{
+    auto [strings, pairs] = MakeShortStringPairs();
+    for (auto _ : state)
+    {
+        (void)_;
+        for (std::size_t i = 0; i<strings.size(); i += 2)
+        {
+            benchmark::DoNotOptimize(ies::DamerauLevenshtein(strings[i], strings[i+1]));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(pairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshtein_Pairs);
+
+void
+BM_DamerauLevenshteinBatch(benchmark::State &state)
+{
+    auto [strings, pairs] = MakeShortStringPairs();
+    std::vector<std::size_t> distances(pairs.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::DamerauLevenshteinBatch(pairs, distances, static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(distances.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(pairs.size()));
+}
+BENCHMARK(BM_DamerauLevenshteinBatch)->Arg(1)->Arg(4)->UseRealTime();
+
+std::vector<std::string>
+MakeIdentifierNames(std::size_t count)
+{
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i<count; ++i)
+    {
+        names.emplace_back("object_name_"+std::to_string(i*7919%count));
+    }
+    return names;
+}
+
+void
+BM_StringInterner_Intern(benchmark::State &state)
+{
+    auto names = MakeIdentifierNames(10000);
+    ies::StringInterner interner;
+    for (auto &name : names)
+    {
+        interner.Intern(name);
+    }
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &name : names)
+        {
+            benchmark::DoNotOptimize(interner.Intern(name));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(names.size()));
+}
+BENCHMARK(BM_StringInterner_Intern);
+
+void
+BM_UnorderedSet_Find(benchmark::State &state)
+{
+    auto names = MakeIdentifierNames(10000);
+    std::unordered_set<std::string> set{names.begin(), names.end()};
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &name : names)
+        {
+            benchmark::DoNotOptimize(set.find(name));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(names.size()));
+}
+BENCHMARK(BM_UnorderedSet_Find);
+
+void
+BM_StringInterner_CompareSymbol(benchmark::State &state)
+{
+    auto names = MakeIdentifierNames(10000);
+    std::vector<ies::Symbol> symbols;
+    for (auto &name : names)
+    {
+        symbols.emplace_back(ies::StringInterner::GetGlobal().Intern(name));
+    }
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t equalCount = 0;
+        for (std::size_t i = 1; i<symbols.size(); ++i)
+        {
+            equalCount += (symbols[i]==symbols[i-1]) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(equalCount);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(symbols.size()-1));
+}
+BENCHMARK(BM_StringInterner_CompareSymbol);
+
+void
+BM_StringInterner_CompareString(benchmark::State &state)
+{
+    auto names = MakeIdentifierNames(10000);
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t equalCount = 0;
+        for (std::size_t i = 1; i<names.size(); ++i)
+        {
+            equalCount += (names[i]==names[i-1]) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(equalCount);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(names.size()-1));
+}
+BENCHMARK(BM_StringInterner_CompareString);
+
+//'' dictionary of [wordCount] distinct words joined from 2~4 random syllables, so words share prefixes like natural words,
+//'' and queries as dictionary words with 1 typo.
+std::pair<std::vector<std::string>, std::vector<std::string>>
+MakeFuzzyDictionary(std::size_t wordCount)
+{
+    const std::string consonants = "bcdfghklmnprstvwz";
+    const std::string vowels = "aeiou";
+    std::vector<std::string> syllables;
+    for (auto c : consonants)
+    {
+        for (auto v : vowels)
+        {
+            syllables.emplace_back(std::string{c, v});
+            syllables.emplace_back(std::string{c, v, 'n'});
+        }
+    }
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<std::size_t> syllableCountDistribution{2, 4};
+    std::uniform_int_distribution<std::size_t> syllableDistribution{0, syllables.size()-1};
+    std::set<std::string> wordSet;
+    while (wordSet.size()<wordCount)
+    {
+        std::string word;
+        auto syllableCount = syllableCountDistribution(generator);
+        for (std::size_t i = 0; i<syllableCount; ++i)
+        {
+            word += syllables[syllableDistribution(generator)];
+        }
+        wordSet.emplace(word);
+    }
+    std::vector<std::string> words(wordSet.begin(), wordSet.end());
+    std::shuffle(words.begin(), words.end(), generator);
+
+    std::vector<std::string> queries;
+    std::uniform_int_distribution<int> charDistribution{0, 25};
+    for (std::size_t i = 0; i<100; ++i)
+    {
+        auto query = words[std::uniform_int_distribution<std::size_t>{0, wordCount-1}(generator)];
+        query[query.size()/2] = static_cast<char>('a'+charDistribution(generator));
+        queries.emplace_back(query);
+    }
+    return {words, queries};
+}
+
+void
+BM_FuzzyIndex_FindWithin(benchmark::State &state)
+{
+    auto [words, queries] = MakeFuzzyDictionary(static_cast<std::size_t>(state.range(0)));
+    ies::FuzzyIndex index{words};
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &query : queries)
+        {
+            benchmark::DoNotOptimize(index.FindWithin(query, 2));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_FuzzyIndex_FindWithin)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+void
+BM_FuzzyIndex_FindTopK(benchmark::State &state)
+{
+    auto [words, queries] = MakeFuzzyDictionary(static_cast<std::size_t>(state.range(0)));
+    ies::FuzzyIndex index{words};
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &query : queries)
+        {
+            benchmark::DoNotOptimize(index.FindTopK(query, 5));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_FuzzyIndex_FindTopK)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+//'' linear scan baseline of BM_FuzzyIndex_FindWithin.
+void
+BM_DamerauLevenshteinBounded_Scan(benchmark::State &state)
+{
+    auto [words, queries] = MakeFuzzyDictionary(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto &query : queries)
+        {
+            std::vector<std::size_t> matches;
+            for (std::size_t i = 0; i<words.size(); ++i)
+            {
+                if (ies::DamerauLevenshteinBounded(words[i], query, 2))
+                {
+                    matches.emplace_back(i);
+                }
+            }
+            benchmark::DoNotOptimize(matches);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_DamerauLevenshteinBounded_Scan)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+void
+BM_IntRange_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        IntRange irange{0, 1000};
+        benchmark::DoNotOptimize(irange);
+    }
+}
+BENCHMARK(BM_IntRange_Construct);
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_RawLoop_Const)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (int i=0; i<1000; ++i)
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_DEFINE_F(Fixture, IntRange_RawLoop_Iterate)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (int i=0; i<state.range(0); ++i)
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK_REGISTER_F(Fixture, IntRange_RawLoop_Iterate)
+->Arg(10)
+->Arg(100)
+->Arg(1000)
+;
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_Iterate)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto i : intRange)
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+//'' same loop as IntRange_RawLoop_Iterate with run-time bound.
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_DEFINE_F(Fixture, IntRange_Iterate_RunTime)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto i : IntRange{0, static_cast<int>(state.range(0))})
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK_REGISTER_F(Fixture, IntRange_Iterate_RunTime)
+->Arg(10)
+->Arg(100)
+->Arg(1000)
+;
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_DEFINE_F(Fixture, ReverseIntRange_Iterate_RunTime)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto i : ReverseIntRange{0, static_cast<int>(state.range(0))})
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK_REGISTER_F(Fixture, ReverseIntRange_Iterate_RunTime)
+->Arg(10)
+->Arg(100)
+->Arg(1000)
+;
+
+//'' random access iterator for std::ranges: distance is O(1), lower_bound is binary search.
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_LowerBound)(benchmark::State &state)
+{
+    const IntRange range{0, 1<<30};
+    for (auto _ : state)
+    {
+        (void)_;
+        auto distance = std::ranges::distance(range);
+        auto it = std::ranges::lower_bound(range, 123456789);
+        benchmark::DoNotOptimize(distance);
+        benchmark::DoNotOptimize(it);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_IterateAndConstruct)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        long long sum = 0;
+        for (auto i : IntRange{0, 1000})
+        {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_IsInRange)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto isInRange = intRange.IsInRange(1750);
+        benchmark::DoNotOptimize(isInRange);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_FindClosest)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto closest = intRange.FindClosest(1750);
+        benchmark::DoNotOptimize(closest);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_FindDistance)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto distance = intRange.FindDistance(1750);
+        benchmark::DoNotOptimize(distance);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_Contains)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto contains = intRange.Contains(intRange2);
+        benchmark::DoNotOptimize(contains);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_Overlaps)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto overlaps = intRange.Overlaps(intRange2);
+        benchmark::DoNotOptimize(overlaps);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_Equal)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto equals = (intRange==intRange2);
+        benchmark::DoNotOptimize(equals);
+    }
+}
+
+//'' 1M values in [0, 2000), about half in intRange [0, 1000).
+std::vector<int>
+MakeIntColumn()
+{
+    std::vector<int> values(1u<<20);
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> distribution{0, 1999};
+    for (auto &value : values)
+    {
+        value = distribution(generator);
+    }
+    return values;
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_IsInRange_Loop)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t count = 0;
+        for (auto value : values)
+        {
+            if (intRange.IsInRange(value))
+            {
+                ++count;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_CountInRange)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    for (auto _ : state)
+    {
+        (void)_;
+        auto count = CountInRange(intRange, std::span<const int>{values});
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_MaskInRange)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    std::vector<std::uint64_t> mask((values.size()+63)/64);
+    for (auto _ : state)
+    {
+        (void)_;
+        MaskInRange(intRange, std::span<const int>{values}, mask);
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_FindClosest_Loop)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    std::vector<int> closest(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (std::size_t i = 0; i<values.size(); ++i)
+        {
+            closest[i] = intRange.FindClosest(values[i]);
+        }
+        benchmark::DoNotOptimize(closest.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_FindClosest_Bulk)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    std::vector<int> closest(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        FindClosest(intRange, std::span<const int>{values}, closest);
+        benchmark::DoNotOptimize(closest.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, IntRange_ClampToRange)(benchmark::State &state)
+{
+    auto values = MakeIntColumn();
+    std::vector<int> clamped(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        ClampToRange(intRange, std::span<const int>{values}, clamped);
+        benchmark::DoNotOptimize(clamped.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+
+void
+BM_IndexRange_CountInRange(benchmark::State &state)
+{
+    std::vector<std::size_t> values(1u<<20);
+    std::iota(values.begin(), values.end(), std::size_t{0});
+    const IndexRange range{1000, 500000};
+    for (auto _ : state)
+    {
+        (void)_;
+        auto count = CountInRange(range, std::span<const std::size_t>{values});
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_IndexRange_CountInRange);
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, Shift)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto shifted = Shift(intRange, 50);
+        benchmark::DoNotOptimize(shifted);
+    }
+}
+
+// NOLINTNEXTLINE(readability-redundant-member-init)
+BENCHMARK_F(Fixture, ToString)(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto format = ToString(intRange);
+        benchmark::DoNotOptimize(format);
+    }
+}
+
+//'' 1M address ranges [32i, 32i+16) with gaps, queried by random addresses.
+std::vector<ies::IntegralRange<unsigned long long>>
+MakeAddressRanges()
+{
+    std::vector<ies::IntegralRange<unsigned long long>> ranges;
+    ranges.reserve(1u<<20);
+    for (unsigned long long i = 0; i<(1u<<20); ++i)
+    {
+        ranges.emplace_back(i*32, i*32+16);
+    }
+    return ranges;
+}
+
+std::vector<unsigned long long>
+MakeAddressQueries()
+{
+    std::vector<unsigned long long> queries(4096);
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<unsigned long long> distribution{0, (1ull<<20)*32};
+    for (auto &query : queries)
+    {
+        query = distribution(generator);
+    }
+    return queries;
+}
+
+void
+BM_IntegralRangeList_Build(benchmark::State &state)
+{
+    auto ranges = MakeAddressRanges();
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::IntegralRangeList<unsigned long long> list{ranges};
+        benchmark::DoNotOptimize(list);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(ranges.size()));
+}
+BENCHMARK(BM_IntegralRangeList_Build)->Unit(benchmark::kMillisecond);
+
+//'' baseline: ranges in std::map begin->end, as IntegralRangeList stored before.
+void
+BM_StdMap_RangeLookup(benchmark::State &state)
+{
+    std::map<unsigned long long, unsigned long long> beginToEndMap;
+    for (const auto &range : MakeAddressRanges())
+    {
+        beginToEndMap.emplace_hint(beginToEndMap.end(), range.GetBegin(), range.GetEnd());
+    }
+    auto queries = MakeAddressQueries();
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t count = 0;
+        for (auto query : queries)
+        {
+            auto it = beginToEndMap.upper_bound(query);
+            if (it!=beginToEndMap.begin() && query<std::prev(it)->second)
+            {
+                ++count;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_StdMap_RangeLookup);
+
+void
+BM_IntegralRangeList_HasRange(benchmark::State &state)
+{
+    ies::IntegralRangeList<unsigned long long> list{MakeAddressRanges()};
+    auto queries = MakeAddressQueries();
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t count = 0;
+        for (auto query : queries)
+        {
+            count += list.HasRange(query) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_IntegralRangeList_HasRange);
+
+void
+BM_IntegralRangeList_HasSpace(benchmark::State &state)
+{
+    ies::IntegralRangeList<unsigned long long> list{MakeAddressRanges()};
+    auto queries = MakeAddressQueries();
+    for (auto _ : state)
+    {
+        (void)_;
+        std::size_t count = 0;
+        for (auto query : queries)
+        {
+            count += list.HasSpace({query, query+8}) ? 1u : 0u;
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(queries.size()));
+}
+BENCHMARK(BM_IntegralRangeList_HasSpace);
+
+//'' 1M random addresses against 1M ranges, by GetRanges() order if state.range(0) is 1.
+std::vector<unsigned long long>
+MakeAddressBatch(bool isSorted)
+{
+    std::vector<unsigned long long> values(1u<<20);
+    std::mt19937_64 generator{42};
+    std::uniform_int_distribution<unsigned long long> distribution{0, (1ull<<20)*32};
+    for (auto &value : values)
+    {
+        value = distribution(generator);
+    }
+    if (isSorted)
+    {
+        std::sort(values.begin(), values.end());
+    }
+    return values;
+}
+
+void
+BM_IntegralRangeList_FindRangeIndex(benchmark::State &state)
+{
+    ies::IntegralRangeList<unsigned long long> list{MakeAddressRanges()};
+    auto values = MakeAddressBatch(state.range(0)!=0);
+    std::vector<std::size_t> indexes(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (std::size_t i = 0; i<values.size(); ++i)
+        {
+            indexes[i] = list.FindRangeIndex(values[i]);
+        }
+        benchmark::DoNotOptimize(indexes.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_IntegralRangeList_FindRangeIndex)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+void
+BM_IntegralRangeList_FindRangeIndexes(benchmark::State &state)
+{
+    ies::IntegralRangeList<unsigned long long> list{MakeAddressRanges()};
+    auto values = MakeAddressBatch(true);
+    std::vector<std::size_t> indexes(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        list.FindRangeIndexes(values, indexes);
+        benchmark::DoNotOptimize(indexes.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_IntegralRangeList_FindRangeIndexes)->Unit(benchmark::kMillisecond);
+
+void
+BM_IntegralRangeLookup_FindRangeIndexes(benchmark::State &state)
+{
+    ies::IntegralRangeLookup<unsigned long long> lookup{ies::IntegralRangeList<unsigned long long>{MakeAddressRanges()}};
+    auto values = MakeAddressBatch(false);
+    std::vector<std::size_t> indexes(values.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        lookup.FindRangeIndexes(values, indexes, static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(indexes.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(values.size()));
+}
+BENCHMARK(BM_IntegralRangeLookup_FindRangeIndexes)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+//'' two sets of 1M ranges interleaving each other, [32i, 32i+16) and [32i+8, 32i+24).
+void
+BM_IntegralRangeSet_Union(benchmark::State &state)
+{
+    auto ranges = MakeAddressRanges();
+    ies::IntegralRangeSet<unsigned long long> lhs{ranges};
+    for (auto &range : ranges)
+    {
+        range = {range.GetBegin()+8, range.GetEnd()+8};
+    }
+    ies::IntegralRangeSet<unsigned long long> rhs{ranges};
+    for (auto _ : state)
+    {
+        (void)_;
+        auto result = Union(lhs, rhs);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(2*ranges.size()));
+}
+BENCHMARK(BM_IntegralRangeSet_Union)->Unit(benchmark::kMillisecond);
+
+//'' allocator-like churn: first-fit allocate and free 16 values in space of 64K values.
+void
+BM_IntegralRangeSet_FirstFitAllocate(benchmark::State &state)
+{
+    const ies::IntegralRange<unsigned long long> space{0, 1u<<16};
+    ies::IntegralRangeSet<unsigned long long> used;
+    std::mt19937_64 generator{42};
+    std::vector<ies::IntegralRange<unsigned long long>> allocated;
+    for (auto _ : state)
+    {
+        (void)_;
+        if (allocated.size()<2048)
+        {
+            auto fit = used.FindFirstFit(16, space);
+            if (fit)
+            {
+                used.InsertRange(*fit);
+                allocated.push_back(*fit);
+            }
+        }
+        else
+        {
+            auto index = generator()%allocated.size();
+            used.RemoveRange(allocated[index]);
+            allocated[index] = allocated.back();
+            allocated.pop_back();
+        }
+    }
+}
+BENCHMARK(BM_IntegralRangeSet_FirstFitAllocate);
+
+//'' transpose of 2048x2048 float matrix, one side is read or written with stride of a row.
+constexpr std::size_t TransposeSize = 2048;
+
+void
+BM_Transpose_NestedLoop(benchmark::State &state)
+{
+    std::vector<float> input(TransposeSize*TransposeSize, 1.0f);
+    std::vector<float> output(input.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto y : ies::IndexRange{0, TransposeSize})
+        {
+            for (auto x : ies::IndexRange{0, TransposeSize})
+            {
+                output[x*TransposeSize+y] = input[y*TransposeSize+x];
+            }
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Transpose_NestedLoop)->Unit(benchmark::kMillisecond);
+
+void
+BM_Transpose_StridedTiles(benchmark::State &state)
+{
+    constexpr std::size_t tileSize = 32;
+    std::vector<float> input(TransposeSize*TransposeSize, 1.0f);
+    std::vector<float> output(input.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto ty : ies::Stride(ies::IndexRange{0, TransposeSize}, tileSize))
+        {
+            for (auto tx : ies::Stride(ies::IndexRange{0, TransposeSize}, tileSize))
+            {
+                for (auto y : ies::IndexRange{ty, ty+tileSize})
+                {
+                    for (auto x : ies::IndexRange{tx, tx+tileSize})
+                    {
+                        output[x*TransposeSize+y] = input[y*TransposeSize+x];
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Transpose_StridedTiles)->Unit(benchmark::kMillisecond);
+
+//'' Arg: 0 RowMajor, 1 Tiled 32x32, 2 Morton.
+void
+BM_Transpose_ProductRange(benchmark::State &state)
+{
+    const std::array<ies::IndexRange, 2> ranges{ies::IndexRange{0, TransposeSize}, ies::IndexRange{0, TransposeSize}};
+    const std::vector<ies::ProductRange<std::size_t, 2>> products{
+        ies::ProductRange<std::size_t, 2>{ranges},
+        ies::ProductRange<std::size_t, 2>{ranges, {32, 32}},
+        ies::ProductRange<std::size_t, 2>{ranges, ies::ProductOrder::Morton}};
+    const auto &product = products[static_cast<std::size_t>(state.range(0))];
+    std::vector<float> input(TransposeSize*TransposeSize, 1.0f);
+    std::vector<float> output(input.size());
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto [y, x] : product)
+        {
+            output[x*TransposeSize+y] = input[y*TransposeSize+x];
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Transpose_ProductRange)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+
+//'' uneven work: cost of value i grows with i, 8M values.
+double
+ParallelWork(std::size_t i)
+{
+    double x = static_cast<double>(i);
+    for (std::size_t k = 0; k<(i>>21); ++k)
+    {
+        x = x*0.5+1.0;
+    }
+    return x;
+}
+
+constexpr std::size_t ParallelWorkSize = 1u<<23;
+
+void
+BM_SerialFor(benchmark::State &state)
+{
+    std::vector<double> output(ParallelWorkSize);
+    for (auto _ : state)
+    {
+        (void)_;
+        for (auto i : ies::IndexRange{0, output.size()})
+        {
+            output[i] = ParallelWork(i);
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(output.size()));
+}
+BENCHMARK(BM_SerialFor)->Unit(benchmark::kMillisecond);
+
+void
+BM_ParallelFor(benchmark::State &state)
+{
+    std::vector<double> output(ParallelWorkSize);
+    for (auto _ : state)
+    {
+        (void)_;
+        ies::ParallelFor(ies::IndexRange{0, output.size()}, [&](std::size_t i){ output[i] = ParallelWork(i); });
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(output.size()));
+}
+BENCHMARK(BM_ParallelFor)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void
+BM_ParallelReduce(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        (void)_;
+        auto sum = ies::ParallelReduce(ies::IndexRange{0, ParallelWorkSize}, 0.0, ParallelWork, std::plus<>{});
+        benchmark::DoNotOptimize(sum);
     }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*static_cast<int64_t>(ParallelWorkSize));
 }
+BENCHMARK(BM_ParallelReduce)->UseRealTime()->Unit(benchmark::kMillisecond);
 
 BENCHMARK_MAIN();
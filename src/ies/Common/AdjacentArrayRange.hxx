@@ -29,14 +29,14 @@ public:
         AdjacentArrayIterator(FwdIt first, FwdIt last)
         :   mFirst(first), mNext(first), mLast(last)
         {
-            for (auto &i : IndexRange{0, N})
+            for (auto i : IndexRange{0, N})
             {
                 mElementItArray[i] = mLast;
             }
 
             if (mFirst!=mLast)
             {
-                for (auto &i : IndexRange{0, N})
+                for (auto i : IndexRange{0, N})
                 {
                     mElementItArray[i] = mNext;
                     ++mNext;
@@ -74,7 +74,7 @@ public:
             ++mFirst;
             if (mNext==mLast)
             {
-                for (auto &i : IndexRange{0, N})
+                for (auto i : IndexRange{0, N})
                 {
                     mElementItArray[i] = mLast;
                 }
@@ -82,7 +82,7 @@ public:
             }
             else
             {
-                for (auto &i : IndexRange{0, N})
+                for (auto i : IndexRange{0, N})
                 {
                     mElementItArray[i] = std::next(mElementItArray[i]);
                 }
@@ -185,7 +185,7 @@ ToValueArray(const Container &container,
 {
     (void)container;
     std::array<typename Container::value_type, N> array{};
-    for (auto &i : IndexRange{0, N})
+    for (auto i : IndexRange{0, N})
     {
         array[i] = *iteratorArray[i];
     }
@@ -212,7 +212,7 @@ ToValueArray(const Container &container,
 {
     (void)container;
     std::array<typename Container::mapped_type, N> array{};
-    for (auto &i : IndexRange{0, N})
+    for (auto i : IndexRange{0, N})
     {
         array[i] = iteratorArray[i]->second;
     }
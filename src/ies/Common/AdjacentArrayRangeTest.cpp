@@ -32,7 +32,7 @@ TEST(AdjacentArrayRange, N2)
     for (auto itArray : MakeAdjacentArrayRange<2>(set))
     {
         std::array<int, 2> array{-1, -1};
-        for (auto &i : UIntRange(0, 2))
+        for (auto i : UIntRange(0, 2))
         {
             array[i] = *itArray[i];
         }
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace ies { namespace Detail {
+
+//! @brief Random access iterator of AdjacentSpanRange, window is [mFirst, mFirst+size).
+//! @note Same as std::ranges::iota_view, iterator_concept is random access and iterator_category is input,
+//! since reference is a span prvalue.
+template <typename T, std::size_t Extent>
+class AdjacentSpanIterator final
+{
+public:
+    using ElementType = std::span<const T, Extent>;
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = ElementType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = ElementType;
+
+        AdjacentSpanIterator() = default;
+
+        AdjacentSpanIterator(const T* first, std::size_t size)
+        :   mFirst(first), mSize(size)
+        {}
+
+        ElementType
+        operator*()
+        const
+        {
+            return ElementType(mFirst, mSize);
+        }
+
+        ElementType
+        operator[](difference_type n)
+        const
+        {
+            return ElementType(mFirst+n, mSize);
+        }
+
+        AdjacentSpanIterator &
+        operator++()
+        {
+            ++mFirst;
+            return *this;
+        }
+
+        AdjacentSpanIterator
+        operator++(int)
+        {
+            auto copy = *this;
+            ++mFirst;
+            return copy;
+        }
+
+        AdjacentSpanIterator &
+        operator--()
+        {
+            --mFirst;
+            return *this;
+        }
+
+        AdjacentSpanIterator
+        operator--(int)
+        {
+            auto copy = *this;
+            --mFirst;
+            return copy;
+        }
+
+        AdjacentSpanIterator &
+        operator+=(difference_type n)
+        {
+            mFirst += n;
+            return *this;
+        }
+
+        AdjacentSpanIterator &
+        operator-=(difference_type n)
+        {
+            mFirst -= n;
+            return *this;
+        }
+
+        friend AdjacentSpanIterator operator+(AdjacentSpanIterator it, difference_type n) { return it += n; }
+        friend AdjacentSpanIterator operator+(difference_type n, AdjacentSpanIterator it) { return it += n; }
+        friend AdjacentSpanIterator operator-(AdjacentSpanIterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const AdjacentSpanIterator &lhs, const AdjacentSpanIterator &rhs) { return lhs.mFirst-rhs.mFirst; }
+
+        friend bool operator==(const AdjacentSpanIterator &lhs, const AdjacentSpanIterator &rhs) { return lhs.mFirst==rhs.mFirst; }
+        friend auto operator<=>(const AdjacentSpanIterator &lhs, const AdjacentSpanIterator &rhs) { return lhs.mFirst<=>rhs.mFirst; }
+
+private:
+    const T* mFirst{nullptr};
+    std::size_t mSize{0};
+};
+
+template <typename T, std::size_t Extent>
+class AdjacentSpanRange final
+{
+public:
+    using IteratorType = AdjacentSpanIterator<T, Extent>;
+
+        AdjacentSpanRange(std::span<const T> elements, std::size_t size)
+        :   mElements(elements), mSize(size)
+        {
+            if (mSize<=1)
+            {
+                throw std::runtime_error("size cannot <=1.");
+            }
+        }
+
+        IteratorType
+        begin()
+        const
+        {
+            return IteratorType(mElements.data(), mSize);
+        }
+
+        IteratorType
+        end()
+        const
+        {
+            return begin()+static_cast<std::ptrdiff_t>(size());
+        }
+
+    //! @brief Number of windows, 0 if container has less than window size elements.
+        std::size_t
+        size()
+        const
+        {
+            return (mElements.size()>=mSize) ? mElements.size()-mSize+1 : 0;
+        }
+
+        bool empty() const { return size()==0; }
+
+private:
+    std::span<const T> mElements;
+    std::size_t mSize;
+};
+
+template <typename Container>
+using ContiguousValueType = std::remove_cv_t<std::ranges::range_value_t<const Container>>;
+
+}}
+
+namespace ies
+{
+
+//! @brief Create a range of adjacent elements of contiguous container (e.g. std::vector, std::array, std::string),
+//! each element of range is current window std::span<const T> of rangeSize elements, viewing container without copy.
+//! e.g. Container = {0, 1, 2, 3}, first element of AdjacentSpanRange(3) is span {0, 1, 2}, second is {1, 2, 3}.
+//! Each step is O(1) and no allocation, unlike AdjacentVectorRange which shifts and copies vector of iterators.
+//! @note Use AdjacentVectorRange for non-contiguous containers (e.g. std::list, std::map).
+//! @note Window spans view container, container must outlive them and not be resized.
+//! @example
+//!     for (auto window : MakeAdjacentSpanRange(samples, n))
+//!     {
+//!         movingAverage.push_back(std::reduce(window.begin(), window.end())/n);
+//!     }
+//! @throw std::runtime_error if rangeSize<=1.
+template <typename Container>
+Detail::AdjacentSpanRange<Detail::ContiguousValueType<Container>, std::dynamic_extent>
+MakeAdjacentSpanRange(const Container &container, std::size_t rangeSize)
+{
+    static_assert(std::ranges::contiguous_range<const Container> && std::ranges::sized_range<const Container>,
+                  "MakeAdjacentSpanRange needs contiguous container, use MakeAdjacentVectorRange instead.");
+    std::span<const Detail::ContiguousValueType<Container>> elements{std::ranges::data(container), std::ranges::size(container)};
+    return {elements, rangeSize};
+}
+
+//! @brief Compile time window size version of MakeAdjacentSpanRange, element is std::span<const T, N>.
+template <std::size_t N, typename Container>
+Detail::AdjacentSpanRange<Detail::ContiguousValueType<Container>, N>
+MakeAdjacentSpanRange(const Container &container)
+{
+    static_assert(N>1, "MakeAdjacentSpanRange needs window size N>1.");
+    static_assert(std::ranges::contiguous_range<const Container> && std::ranges::sized_range<const Container>,
+                  "MakeAdjacentSpanRange needs contiguous container, use MakeAdjacentArrayRange instead.");
+    std::span<const Detail::ContiguousValueType<Container>> elements{std::ranges::data(container), std::ranges::size(container)};
+    return {elements, N};
+}
+
+}
+
+template <typename T, std::size_t Extent>
+inline constexpr bool std::ranges::enable_view<ies::Detail::AdjacentSpanRange<T, Extent>> = true;
+
+template <typename T, std::size_t Extent>
+inline constexpr bool std::ranges::enable_borrowed_range<ies::Detail::AdjacentSpanRange<T, Extent>> = true;
@@ -0,0 +1,82 @@
+#include "ies/Common/AdjacentSpanRange.hxx"
+
+#include <array>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+static_assert(std::random_access_iterator<Detail::AdjacentSpanIterator<int, std::dynamic_extent>>);
+static_assert(std::ranges::view<Detail::AdjacentSpanRange<int, 2>>);
+static_assert(std::ranges::borrowed_range<Detail::AdjacentSpanRange<int, std::dynamic_extent>>);
+static_assert(std::is_same_v<std::iterator_traits<Detail::AdjacentSpanIterator<int, 2>>::iterator_category, std::input_iterator_tag>);
+
+TEST(AdjacentSpanRange, DynamicSize)
+{
+    std::vector<int> v{1, 2, 3, 4, 5, 6};
+    std::vector<std::size_t> expectCount{5, 4, 3, 2, 1, 0};
+    std::vector<std::size_t> actualCount;
+    for (std::size_t windowSize = 2; windowSize<=7; ++windowSize)
+    {
+        std::size_t count = 0;
+        for (auto window : MakeAdjacentSpanRange(v, windowSize))
+        {
+            //'' window views container, first element is count-th element.
+            EXPECT_EQ(windowSize, window.size());
+            EXPECT_EQ(v.data()+count, window.data());
+            ++count;
+        }
+        EXPECT_EQ(count, MakeAdjacentSpanRange(v, windowSize).size());
+        actualCount.push_back(count);
+    }
+
+    ASSERT_EQ(expectCount, actualCount);
+}
+
+TEST(AdjacentSpanRange, FixedSize)
+{
+    const std::array<int, 4> a{0, 1, 2, 3};
+    std::vector<std::vector<int>> actual;
+    std::vector<std::vector<int>> expected{{0, 1, 2}, {1, 2, 3}};
+
+    for (std::span<const int, 3> window : MakeAdjacentSpanRange<3>(a))
+    {
+        actual.emplace_back(window.begin(), window.end());
+    }
+
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(AdjacentSpanRange, RandomAccess)
+{
+    std::string s{"abcdef"};
+    auto range = MakeAdjacentSpanRange(s, 2);
+    auto it = range.begin();
+
+    EXPECT_EQ(5, range.end()-range.begin());
+    EXPECT_EQ('c', it[2][0]);
+    EXPECT_EQ('f', (*(range.end()-1))[1]);
+    EXPECT_TRUE(it<range.end());
+    EXPECT_EQ(3, std::ranges::distance(range | std::views::drop(2)));
+    ASSERT_EQ('b', (*++it)[0]);
+}
+
+TEST(AdjacentSpanRange, Invalid)
+{
+    std::vector<int> v{1, 2};
+    std::vector<int> empty;
+
+    EXPECT_TRUE(MakeAdjacentSpanRange(empty, 2).empty());
+    EXPECT_EQ(MakeAdjacentSpanRange(empty, 2).begin(), MakeAdjacentSpanRange(empty, 2).end());
+    ASSERT_THROW(MakeAdjacentSpanRange(v, 1), std::runtime_error);
+}
+
+}
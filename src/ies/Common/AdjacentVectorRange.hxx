@@ -31,7 +31,7 @@ public:
 
             if (mFirst!=mLast)
             {
-                for (auto &i : mRange)
+                for (auto i : mRange)
                 {
                     mElementItVector[i] = mNext;
                     ++mNext;
@@ -69,7 +69,7 @@ public:
             ++mFirst;
             if (mNext==mLast)
             {
-                for (auto &i : mRange)
+                for (auto i : mRange)
                 {
                     mElementItVector[i] = mLast;
                 }
@@ -77,7 +77,7 @@ public:
             }
             else
             {
-                for (auto &i : mRange)
+                for (auto i : mRange)
                 {
                     mElementItVector[i] = std::next(mElementItVector[i]);
                 }
@@ -155,6 +155,7 @@ namespace ies
 //!                   ^  ^  ^      first element  {it0, it1, it2}
 //!                      ^  ^  ^   second element {it1, it2, it3}
 //! @note Use AdjacentArrayRange version if rangeSize is known at compile time.
+//! @note For contiguous container, MakeAdjacentSpanRange views windows as std::span without allocation.
 //! @note Do not use reference of element (Due to impl limit).
 //! e.g. do
 //!     for (auto itVector : MakeAdjacentVectorRange(container, n))
@@ -188,7 +189,7 @@ ToValueVector(const Container &container,
 {
     (void)container;
     std::vector<typename Container::value_type> vector(iteratorVector.size());
-    for (auto &i : IndexRange{0, iteratorVector.size()})
+    for (auto i : IndexRange{0, iteratorVector.size()})
     {
         vector[i] = *iteratorVector[i];
     }
@@ -214,7 +215,7 @@ ToValueVector(const Container &container,
 {
     (void)container;
     std::vector<typename Container::mapped_type> vector(iteratorVector.size());
-    for (auto &i : IndexRange{0, iteratorVector.size()})
+    for (auto i : IndexRange{0, iteratorVector.size()})
     {
         vector[i] = iteratorVector[i]->second;
     }
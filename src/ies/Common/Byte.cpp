@@ -1,14 +1,230 @@
 #include "ies/Common/Byte.hpp"
 
-#include <iostream>
+#include "ies/Common/Simd.hpp"
 
-#include "fmt/format.h"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
 
-#include "ies/Common/IntegralRange.hxx"
+#if IES_SIMD_SSSE3
+#include <tmmintrin.h>
+#endif
 
 namespace ies
 {
 
+namespace
+{
+
+constexpr std::size_t BytesPerLine = 16;
+//'' each byte is a cell of separator and 2 hex digits.
+constexpr std::size_t CellsSize = BytesPerLine*3;
+//'' lines per chunk when writing to stream.
+constexpr std::size_t StreamChunkLineCount = 4096;
+
+constexpr char HexDigits[] = "0123456789ABCDEF";
+
+constexpr std::array<char, 512>
+MakeHexPairTable()
+{
+    std::array<char, 512> table{};
+    for (std::size_t i = 0; i<256; ++i)
+    {
+        table[2*i] = HexDigits[i>>4];
+        table[2*i+1] = HexDigits[i&0xF];
+    }
+    return table;
+}
+
+//'' "00" to "FF" of each byte.
+constexpr auto HexPairTable = MakeHexPairTable();
+
+constexpr char
+GetSeparator(std::size_t column)
+{
+    return (column==0 || column==8) ? '|' : ' ';
+}
+
+std::size_t
+GetHexDigitCount(std::size_t value)
+{
+    std::size_t count = 1;
+    while (value>=16)
+    {
+        value >>= 4;
+        ++count;
+    }
+    return count;
+}
+
+std::string
+MakeHeader(std::size_t begin, std::size_t end, const std::string &name)
+{
+    return "ByteArray {"+name+"}, range ["+std::to_string(begin)+", "+std::to_string(end)+"), size ["+std::to_string(end-begin)+"]:\n"
+           "|00 01 02 03 04 05 06 07|08 09 0A 0B 0C 0D 0E 0F| Line Offset\n"
+           "+-----------------------+-----------------------+\n";
+}
+
+//'' line is cells, "| ", line index in hex, "0\n".
+std::size_t
+GetLineSize(std::size_t line)
+{
+    return CellsSize+2+GetHexDigitCount(line)+2;
+}
+
+//'' total size of lines [firstLine, lastLine), lines with same hex digit count have same size.
+std::size_t
+GetLinesSize(std::size_t firstLine, std::size_t lastLine)
+{
+    std::size_t size = 0;
+    std::size_t line = firstLine;
+    while (line<lastLine)
+    {
+        auto digitCount = GetHexDigitCount(line);
+        auto digitEnd = (digitCount>=sizeof(std::size_t)*2) ? lastLine : (std::size_t{1}<<(4*digitCount));
+        auto groupEnd = (digitEnd<lastLine) ? digitEnd : lastLine;
+        size += (groupEnd-line)*GetLineSize(line);
+        line = groupEnd;
+    }
+    return size;
+}
+
+#if IES_SIMD_SSSE3
+
+struct LineShuffle
+{
+    //'' shuffle of hex pairs of bytes [0, 8) and [8, 16) to 3 x 16 output chars, -128 is zero.
+    std::array<std::array<std::int8_t, 16>, 3> FromLow{};
+    std::array<std::array<std::int8_t, 16>, 3> FromHigh{};
+    std::array<std::array<char, 16>, 3> Separators{};
+};
+
+constexpr LineShuffle
+MakeLineShuffle()
+{
+    LineShuffle shuffle;
+    for (std::size_t j = 0; j<CellsSize; ++j)
+    {
+        auto column = j/3;
+        auto &fromLow = shuffle.FromLow[j/16][j%16];
+        auto &fromHigh = shuffle.FromHigh[j/16][j%16];
+        auto &separator = shuffle.Separators[j/16][j%16];
+        fromLow = -128;
+        fromHigh = -128;
+        separator = 0;
+        if (j%3==0)
+        {
+            separator = GetSeparator(column);
+            continue;
+        }
+        auto pairIndex = static_cast<std::int8_t>(2*column+(j%3)-1);
+        if (pairIndex<16)
+        {
+            fromLow = pairIndex;
+        }
+        else
+        {
+            fromHigh = static_cast<std::int8_t>(pairIndex-16);
+        }
+    }
+    return shuffle;
+}
+
+constexpr auto LineShuffleTable = MakeLineShuffle();
+
+#endif
+
+char*
+WriteFullLineCells(char* out, const Byte* data)
+{
+#if IES_SIMD_SSSE3
+    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    auto lowMask = _mm_set1_epi8(0x0F);
+    auto digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HexDigits));
+    auto highDigits = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask));
+    auto lowDigits = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowMask));
+    auto pairsLow = _mm_unpacklo_epi8(highDigits, lowDigits);
+    auto pairsHigh = _mm_unpackhi_epi8(highDigits, lowDigits);
+    for (std::size_t i = 0; i<3; ++i)
+    {
+        auto fromLow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LineShuffleTable.FromLow[i].data()));
+        auto fromHigh = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LineShuffleTable.FromHigh[i].data()));
+        auto separators = _mm_loadu_si128(reinterpret_cast<const __m128i*>(LineShuffleTable.Separators[i].data()));
+        auto chars = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(pairsLow, fromLow), _mm_shuffle_epi8(pairsHigh, fromHigh)), separators);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out+16*i), chars);
+    }
+#else
+    for (std::size_t column = 0; column<BytesPerLine; ++column)
+    {
+        out[3*column] = GetSeparator(column);
+        std::memcpy(out+3*column+1, HexPairTable.data()+2*data[column], 2);
+    }
+#endif
+    return out+CellsSize;
+}
+
+//'' columns outside [columnBegin, columnEnd) are blank.
+char*
+WritePartialLineCells(char* out, const Byte* lineData, std::size_t columnBegin, std::size_t columnEnd)
+{
+    for (std::size_t column = 0; column<BytesPerLine; ++column)
+    {
+        out[3*column] = GetSeparator(column);
+        if (column>=columnBegin && column<columnEnd)
+        {
+            std::memcpy(out+3*column+1, HexPairTable.data()+2*lineData[column], 2);
+        }
+        else
+        {
+            out[3*column+1] = ' ';
+            out[3*column+2] = ' ';
+        }
+    }
+    return out+CellsSize;
+}
+
+char*
+WriteLineOffset(char* out, std::size_t line)
+{
+    *out++ = '|';
+    *out++ = ' ';
+    auto digitCount = GetHexDigitCount(line);
+    for (std::size_t i = digitCount; i>0; --i)
+    {
+        out[i-1] = HexDigits[line&0xF];
+        line >>= 4;
+    }
+    out += digitCount;
+    *out++ = '0';
+    *out++ = '\n';
+    return out;
+}
+
+//'' write lines [firstLine, lastLine) of bytes [begin, end) to [out], out must have GetLinesSize() space.
+char*
+WriteLines(char* out, const Byte* data, std::size_t begin, std::size_t end, std::size_t firstLine, std::size_t lastLine)
+{
+    for (auto line = firstLine; line<lastLine; ++line)
+    {
+        auto lineBegin = line*BytesPerLine;
+        if (lineBegin>=begin && lineBegin+BytesPerLine<=end)
+        {
+            out = WriteFullLineCells(out, data+lineBegin);
+        }
+        else
+        {
+            auto columnBegin = (begin>lineBegin) ? begin-lineBegin : 0;
+            auto columnEnd = (end<lineBegin+BytesPerLine) ? end-lineBegin : BytesPerLine;
+            out = WritePartialLineCells(out, data+lineBegin, columnBegin, columnEnd);
+        }
+        out = WriteLineOffset(out, line);
+    }
+    return out;
+}
+
+}
+
 std::string
 ToString(const ByteArray &byteArray, const std::string &name)
 {
@@ -32,60 +248,44 @@ ToString(const Byte* data, std::size_t begin, std::size_t end, const std::string
     {
         begin = end;
     }
-    auto s = "ByteArray {"+name+"}, range ["+std::to_string(begin)+", "+std::to_string(end)+"), size ["+std::to_string(end-begin)+"]:\n"
-             "|00 01 02 03 04 05 06 07|08 09 0A 0B 0C 0D 0E 0F| Line Offset\n"
-             "+-----------------------+-----------------------+\n";
-
+    auto s = MakeHeader(begin, end, name);
     if (begin==end)
     {
         return s;
     }
 
-    auto lineCount = begin/16;
-    if (begin%16!=0)
+    auto firstLine = begin/BytesPerLine;
+    auto lastLine = (end+BytesPerLine-1)/BytesPerLine;
+    auto headerSize = s.size();
+    s.resize(headerSize+GetLinesSize(firstLine, lastLine));
+    WriteLines(s.data()+headerSize, data, begin, end, firstLine, lastLine);
+    return s;
+}
+
+void
+WriteByteArray(std::ostream &stream, const Byte* data, std::size_t begin, std::size_t end, const std::string &name)
+{
+    if (begin>end)
     {
-        for (auto i : IndexRange(0, begin%16))
-        {
-            char separate = '|';
-            if (i%16!=0 && i%16!=8)
-            {
-                separate = ' ';
-            }
-            s += separate+std::string(2, ' ');
-        }
+        begin = end;
     }
-
-    for (auto i : IndexRange(begin, end, EmptyPolicy::Allow))
+    auto header = MakeHeader(begin, end, name);
+    stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+    if (begin==end)
     {
-        char separate = '|';
-        if (i%16!=0 && i%16!=8)
-        {
-            separate = ' ';
-        }
-        s += separate+fmt::format("{:02X}", data[i]);
-
-        if ((i+1)%16==0)
-        {
-            s += "| "+fmt::format("{:X}", lineCount)+"0\n";
-            ++lineCount;
-        }
+        return;
     }
 
-    if (end%16!=0)
+    auto firstLine = begin/BytesPerLine;
+    auto lastLine = (end+BytesPerLine-1)/BytesPerLine;
+    std::string buffer;
+    for (auto chunkBegin = firstLine; chunkBegin<lastLine && stream; chunkBegin += StreamChunkLineCount)
     {
-        for (auto i : IndexRange(end%16, 16))
-        {
-            char separate = '|';
-            if (i%16!=0 && i%16!=8)
-            {
-                separate = ' ';
-            }
-            s += separate+std::string(2, ' ');
-        }
-
-        s += "| "+fmt::format("{:X}", lineCount)+"0\n";
+        auto chunkEnd = (lastLine-chunkBegin>StreamChunkLineCount) ? chunkBegin+StreamChunkLineCount : lastLine;
+        buffer.resize(GetLinesSize(chunkBegin, chunkEnd));
+        WriteLines(buffer.data(), data, begin, end, chunkBegin, chunkEnd);
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
-    return s;
 }
 
 }
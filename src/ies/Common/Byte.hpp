@@ -2,6 +2,9 @@
 
 #include "ies/ies_export.h"
 
+#include <cstddef>
+
+#include <iosfwd>
 #include <string>
 #include <vector>
 
@@ -35,7 +38,15 @@ using ByteArray = std::vector<Byte>;
 
     //! @brief Pretty format content of Byte pointer (of data in ByteArray or c array) between [begin, end).
     //! @note ToString(ByteArray) equivalent to ToString(ByteArray.data(), 0, ByteArray.size()).
+    //! Output size is computed before writing, full lines are converted 16 bytes at once.
     IES_EXPORT
     std::string
     ToString(const Byte* data, std::size_t begin, std::size_t end, const std::string &name="unnamed");
+
+    //! @brief Write same content as ToString(data, begin, end, name) to [stream],
+    //! converted in chunks of 4096 lines so large data do not need whole string in memory.
+    //! @note Stops early if stream fails, check stream state after write.
+    IES_EXPORT
+    void
+    WriteByteArray(std::ostream &stream, const Byte* data, std::size_t begin, std::size_t end, const std::string &name="unnamed");
 }
@@ -0,0 +1,389 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "ies/Common/Byte.hpp"
+#include "ies/Common/Endian.hxx"
+
+namespace ies
+{
+
+//! @brief Total byte size of fixed-size fields [Ts...], for one Require() of a message layout.
+//! @example
+//!     reader.Require(ByteSizeOf<uint32_t, uint16_t, double>); //'' 14
+template <typename... Ts>
+inline constexpr std::size_t ByteSizeOf = (std::size_t{0}+...+sizeof(Ts));
+
+//! @brief Max byte size of 64-bit LEB128 value.
+inline constexpr std::size_t MaxLeb128Size = 10;
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace Detail {
+
+[[noreturn]]
+inline
+void
+ThrowByteCursorOutOfRange(const char* cursorName, std::size_t offset, std::size_t size, std::size_t bufferSize)
+{
+    throw std::runtime_error(std::string{cursorName}+": ["+std::to_string(size)+"] bytes at offset ["+std::to_string(offset)
+                             +"] exceeds buffer size ["+std::to_string(bufferSize)+"].");
+}
+
+}
+
+//! @brief Cursor reading typed values from a byte buffer without copy, bounds are checked.
+//! Values are read by memcpy, buffer does not need alignment.
+//! Each Read*() checks bounds, for hot path call Require() once per message and use Read*Unchecked().
+//! @throw std::runtime_error when reading out of buffer or invalid LEB128.
+//! @example
+//!     ByteReader reader{frame};
+//!     reader.Require(ByteSizeOf<uint16_t, uint32_t>);
+//!     auto type = reader.ReadBigEndianUnchecked<uint16_t>();
+//!     auto length = reader.ReadBigEndianUnchecked<uint32_t>();
+//!     auto payload = reader.ReadSubReader(length);
+class ByteReader
+{
+public:
+        explicit ByteReader(std::span<const Byte> data)
+        :   mData(data)
+        {}
+
+        std::span<const Byte>
+        GetData()
+        const
+        {
+            return mData;
+        }
+
+        std::size_t
+        GetOffset()
+        const
+        {
+            return mOffset;
+        }
+
+        std::size_t
+        GetRemainingSize()
+        const
+        {
+            return mData.size()-mOffset;
+        }
+
+        std::span<const Byte>
+        GetRemaining()
+        const
+        {
+            return mData.subspan(mOffset);
+        }
+
+        bool
+        IsEnd()
+        const
+        {
+            return mOffset==mData.size();
+        }
+
+    //! @brief Check [size] more bytes can be read.
+        void
+        Require(std::size_t size)
+        const
+        {
+            if (size>GetRemainingSize())
+            {
+                Detail::ThrowByteCursorOutOfRange("ByteReader", mOffset, size, mData.size());
+            }
+        }
+
+    //! @brief Move cursor to [offset], can be buffer size (end).
+        void
+        Seek(std::size_t offset)
+        {
+            if (offset>mData.size())
+            {
+                Detail::ThrowByteCursorOutOfRange("ByteReader", offset, 0, mData.size());
+            }
+            mOffset = offset;
+        }
+
+        void
+        Skip(std::size_t size)
+        {
+            Require(size);
+            mOffset += size;
+        }
+
+        template <typename T>
+        T
+        ReadBigEndian()
+        {
+            Require(sizeof(T));
+            return ReadBigEndianUnchecked<T>();
+        }
+
+        template <typename T>
+        T
+        ReadLittleEndian()
+        {
+            Require(sizeof(T));
+            return ReadLittleEndianUnchecked<T>();
+        }
+
+    //! @brief Read without bounds check, must be covered by previous Require().
+        template <typename T>
+        T
+        ReadBigEndianUnchecked()
+        {
+            static_assert(std::is_arithmetic_v<T>, "ByteReader: T must be arithmetic type.");
+            auto value = ToBigEndian<T>(mData.data()+mOffset);
+            mOffset += sizeof(T);
+            return value;
+        }
+
+    //! @brief Read without bounds check, must be covered by previous Require().
+        template <typename T>
+        T
+        ReadLittleEndianUnchecked()
+        {
+            static_assert(std::is_arithmetic_v<T>, "ByteReader: T must be arithmetic type.");
+            auto value = ToLittleEndian<T>(mData.data()+mOffset);
+            mOffset += sizeof(T);
+            return value;
+        }
+
+    //! @brief Read next [size] bytes as span into same buffer (no copy).
+        std::span<const Byte>
+        ReadSpan(std::size_t size)
+        {
+            Require(size);
+            auto span = mData.subspan(mOffset, size);
+            mOffset += size;
+            return span;
+        }
+
+    //! @brief Read next [size] bytes as reader of its own, e.g. for nested message with length prefix.
+        ByteReader
+        ReadSubReader(std::size_t size)
+        {
+            return ByteReader{ReadSpan(size)};
+        }
+
+    //! @brief Read unsigned LEB128 (same as protobuf varint), at most 10 bytes.
+    //! @throw std::runtime_error if truncated or value exceeds 64 bits.
+        std::uint64_t
+        ReadUleb128()
+        {
+            std::uint64_t value = 0;
+            for (unsigned shift = 0;; shift += 7)
+            {
+                Require(1);
+                auto byte = mData[mOffset++];
+                if (shift==63 && (byte&0xFE)!=0)
+                {
+                    throw std::runtime_error("ByteReader: LEB128 at offset ["+std::to_string(mOffset-MaxLeb128Size)+"] exceeds 64 bits.");
+                }
+                value |= std::uint64_t{byte&0x7Fu}<<shift;
+                if ((byte&0x80)==0)
+                {
+                    return value;
+                }
+            }
+        }
+
+    //! @brief Read signed LEB128, at most 10 bytes.
+    //! @throw std::runtime_error if truncated or value exceeds 64 bits.
+        std::int64_t
+        ReadSleb128()
+        {
+            std::uint64_t value = 0;
+            for (unsigned shift = 0;; shift += 7)
+            {
+                Require(1);
+                auto byte = mData[mOffset++];
+                //'' 10th byte only has sign bit, must be sign extension of it.
+                if (shift==63 && byte!=0x00 && byte!=0x7F)
+                {
+                    throw std::runtime_error("ByteReader: LEB128 at offset ["+std::to_string(mOffset-MaxLeb128Size)+"] exceeds 64 bits.");
+                }
+                value |= std::uint64_t{byte&0x7Fu}<<shift;
+                if ((byte&0x80)==0)
+                {
+                    if (shift<57 && (byte&0x40)!=0)
+                    {
+                        value |= ~std::uint64_t{0}<<(shift+7);
+                    }
+                    return static_cast<std::int64_t>(value);
+                }
+            }
+        }
+
+private:
+    std::span<const Byte> mData;
+    std::size_t mOffset{0};
+};
+
+//! @brief Cursor writing typed values to a fixed byte buffer, bounds are checked.
+//! Same as ByteReader, call Require() once per message to use Write*Unchecked().
+//! @throw std::runtime_error when writing out of buffer.
+//! @example
+//!     ByteArray frame(64);
+//!     ByteWriter writer{frame};
+//!     writer.WriteBigEndian<uint16_t>(type);
+//!     writer.WriteUleb128(payload.size());
+//!     writer.WriteBytes(payload);
+//!     send(writer.GetWritten());
+class ByteWriter
+{
+public:
+        explicit ByteWriter(std::span<Byte> buffer)
+        :   mBuffer(buffer)
+        {}
+
+        std::size_t
+        GetOffset()
+        const
+        {
+            return mOffset;
+        }
+
+        std::size_t
+        GetRemainingSize()
+        const
+        {
+            return mBuffer.size()-mOffset;
+        }
+
+    //! @brief Bytes [0, offset) of buffer.
+        std::span<Byte>
+        GetWritten()
+        const
+        {
+            return mBuffer.first(mOffset);
+        }
+
+    //! @brief Check [size] more bytes can be written.
+        void
+        Require(std::size_t size)
+        const
+        {
+            if (size>GetRemainingSize())
+            {
+                Detail::ThrowByteCursorOutOfRange("ByteWriter", mOffset, size, mBuffer.size());
+            }
+        }
+
+    //! @brief Move cursor to [offset], e.g. to fill length field after payload is written.
+        void
+        Seek(std::size_t offset)
+        {
+            if (offset>mBuffer.size())
+            {
+                Detail::ThrowByteCursorOutOfRange("ByteWriter", offset, 0, mBuffer.size());
+            }
+            mOffset = offset;
+        }
+
+        template <typename T>
+        void
+        WriteBigEndian(T value)
+        {
+            Require(sizeof(T));
+            WriteBigEndianUnchecked(value);
+        }
+
+        template <typename T>
+        void
+        WriteLittleEndian(T value)
+        {
+            Require(sizeof(T));
+            WriteLittleEndianUnchecked(value);
+        }
+
+    //! @brief Write without bounds check, must be covered by previous Require().
+        template <typename T>
+        void
+        WriteBigEndianUnchecked(T value)
+        {
+            static_assert(std::is_arithmetic_v<T>, "ByteWriter: T must be arithmetic type.");
+            ies::WriteBigEndian(value, mBuffer.data()+mOffset);
+            mOffset += sizeof(T);
+        }
+
+    //! @brief Write without bounds check, must be covered by previous Require().
+        template <typename T>
+        void
+        WriteLittleEndianUnchecked(T value)
+        {
+            static_assert(std::is_arithmetic_v<T>, "ByteWriter: T must be arithmetic type.");
+            ies::WriteLittleEndian(value, mBuffer.data()+mOffset);
+            mOffset += sizeof(T);
+        }
+
+        void
+        WriteBytes(std::span<const Byte> bytes)
+        {
+            Require(bytes.size());
+            if (!bytes.empty())
+            {
+                std::memcpy(mBuffer.data()+mOffset, bytes.data(), bytes.size());
+            }
+            mOffset += bytes.size();
+        }
+
+    //! @brief Reserve next [size] bytes and return them to be filled in place.
+        std::span<Byte>
+        WriteSpan(std::size_t size)
+        {
+            Require(size);
+            auto span = mBuffer.subspan(mOffset, size);
+            mOffset += size;
+            return span;
+        }
+
+    //! @brief Write unsigned LEB128 (same as protobuf varint).
+        void
+        WriteUleb128(std::uint64_t value)
+        {
+            Byte bytes[MaxLeb128Size];
+            std::size_t size = 0;
+            do
+            {
+                auto byte = static_cast<Byte>(value&0x7F);
+                value >>= 7;
+                bytes[size++] = (value!=0) ? static_cast<Byte>(byte|0x80) : byte;
+            }
+            while (value!=0);
+            WriteBytes({bytes, size});
+        }
+
+        void
+        WriteSleb128(std::int64_t value)
+        {
+            Byte bytes[MaxLeb128Size];
+            std::size_t size = 0;
+            bool isEnd = false;
+            while (!isEnd)
+            {
+                auto byte = static_cast<Byte>(value&0x7F);
+                //'' arithmetic shift keeps sign (defined since C++20).
+                value >>= 7;
+                isEnd = (value==0 && (byte&0x40)==0) || (value==-1 && (byte&0x40)!=0);
+                bytes[size++] = isEnd ? byte : static_cast<Byte>(byte|0x80);
+            }
+            WriteBytes({bytes, size});
+        }
+
+private:
+    std::span<Byte> mBuffer;
+    std::size_t mOffset{0};
+};
+
+}
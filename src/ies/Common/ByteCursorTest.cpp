@@ -0,0 +1,114 @@
+#include "ies/Common/ByteCursor.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace ies
+{
+
+TEST(ByteCursor, ByteReader)
+{
+    ByteArray buffer{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09};
+    ByteReader reader{buffer};
+    EXPECT_EQ(0x0102u, reader.ReadBigEndian<uint16_t>());
+    EXPECT_EQ(0x06050403u, reader.ReadLittleEndian<uint32_t>());
+    EXPECT_EQ(6u, reader.GetOffset());
+    EXPECT_EQ(3u, reader.GetRemainingSize());
+
+    auto span = reader.ReadSpan(2);
+    EXPECT_EQ(buffer.data()+6, span.data());
+    EXPECT_EQ(2u, span.size());
+    EXPECT_THROW(reader.ReadBigEndian<uint16_t>(), std::runtime_error);
+    EXPECT_EQ(8u, reader.GetOffset());
+    EXPECT_EQ(0x09u, reader.ReadBigEndian<uint8_t>());
+    EXPECT_TRUE(reader.IsEnd());
+
+    reader.Seek(1);
+    reader.Require(ByteSizeOf<uint32_t, uint32_t>);
+    EXPECT_EQ(0x02030405u, reader.ReadBigEndianUnchecked<uint32_t>());
+    EXPECT_EQ(0x09080706u, reader.ReadLittleEndianUnchecked<uint32_t>());
+    EXPECT_THROW(reader.Require(1), std::runtime_error);
+    EXPECT_THROW(reader.Seek(10), std::runtime_error);
+
+    reader.Seek(2);
+    auto subReader = reader.ReadSubReader(3);
+    EXPECT_EQ(5u, reader.GetOffset());
+    EXPECT_EQ(0x030405u, (std::uint32_t{subReader.ReadBigEndian<uint16_t>()}<<8)|subReader.ReadBigEndian<uint8_t>());
+    ASSERT_THROW(subReader.Skip(1), std::runtime_error);
+}
+
+TEST(ByteCursor, ByteWriter)
+{
+    ByteArray buffer(8);
+    ByteWriter writer{buffer};
+    writer.WriteBigEndian<uint16_t>(0x0102);
+    writer.WriteLittleEndian<uint16_t>(0x0403);
+    ByteArray payload{0x05, 0x06};
+    writer.WriteBytes(payload);
+    EXPECT_EQ(6u, writer.GetWritten().size());
+    EXPECT_THROW(writer.WriteBigEndian<uint32_t>(0), std::runtime_error);
+    writer.Require(ByteSizeOf<uint16_t>);
+    writer.WriteBigEndianUnchecked<uint16_t>(0x0708);
+    ByteArray expect{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    EXPECT_EQ(expect, buffer);
+
+    writer.Seek(0);
+    writer.WriteBigEndian<float>(1.25F);
+    ByteReader reader{buffer};
+    ASSERT_FLOAT_EQ(1.25F, reader.ReadBigEndian<float>());
+}
+
+TEST(ByteCursor, Leb128)
+{
+    //'' known encodings from DWARF specification.
+    ByteArray buffer(64);
+    ByteWriter writer{buffer};
+    writer.WriteUleb128(2);
+    writer.WriteUleb128(127);
+    writer.WriteUleb128(128);
+    writer.WriteUleb128(12857);
+    writer.WriteSleb128(2);
+    writer.WriteSleb128(-2);
+    writer.WriteSleb128(127);
+    writer.WriteSleb128(-127);
+    writer.WriteSleb128(-128);
+    ByteArray expect{0x02, 0x7F, 0x80, 0x01, 0xB9, 0x64, 0x02, 0x7E, 0xFF, 0x00, 0x81, 0x7F, 0x80, 0x7F};
+    EXPECT_EQ(expect, ByteArray(writer.GetWritten().begin(), writer.GetWritten().end()));
+
+    std::vector<std::uint64_t> unsignedValues{0, 1, 300, 1ull<<32, std::numeric_limits<std::uint64_t>::max()};
+    std::vector<std::int64_t> signedValues{0, -1, 63, -64, 64, -65, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()};
+    writer.Seek(0);
+    for (auto value : unsignedValues)
+    {
+        writer.WriteUleb128(value);
+    }
+    for (auto value : signedValues)
+    {
+        writer.WriteSleb128(value);
+    }
+    ByteReader reader{writer.GetWritten()};
+    for (auto value : unsignedValues)
+    {
+        EXPECT_EQ(value, reader.ReadUleb128());
+    }
+    for (auto value : signedValues)
+    {
+        EXPECT_EQ(value, reader.ReadSleb128());
+    }
+    EXPECT_TRUE(reader.IsEnd());
+
+    ByteArray truncated{0x80, 0x80};
+    ByteReader truncatedReader{truncated};
+    EXPECT_THROW(truncatedReader.ReadUleb128(), std::runtime_error);
+    ByteArray overflow{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    ByteReader overflowReader{overflow};
+    EXPECT_THROW(overflowReader.ReadUleb128(), std::runtime_error);
+    ByteReader overflowSignedReader{overflow};
+    ASSERT_THROW(overflowSignedReader.ReadSleb128(), std::runtime_error);
+}
+
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+#include <cstring>
+
+#include <array>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "ies/Common/Byte.hpp"
+#include "ies/Common/ByteCursor.hxx"
+#include "ies/Common/Endian.hxx"
+#include "ies/Common/SmartEnum.hxx"
+
+namespace ies
+{
+
+IES_SMART_ENUM(ByteOrder,
+    BigEndian,
+    LittleEndian
+);
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace Detail {
+
+template <typename MemberPointer>
+struct MemberPointerTraits;
+
+template <typename ClassType, typename MemberType>
+struct MemberPointerTraits<MemberType ClassType::*>
+{
+    using Class = ClassType;
+    using Member = MemberType;
+};
+
+template <typename T, bool = std::is_enum_v<T>>
+struct LayoutRawType
+{
+    using Type = T;
+};
+
+template <typename T>
+struct LayoutRawType<T, true>
+{
+    using Type = std::underlying_type_t<T>;
+};
+
+//'' ByteLayoutPadding has no Struct and fits any struct.
+template <typename Field, typename Struct>
+constexpr bool
+IsLayoutFieldOf()
+{
+    if constexpr (requires { typename Field::Struct; })
+    {
+        return std::is_same_v<typename Field::Struct, Struct>;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+}
+
+//! @brief Field of ByteLayout: data member [Member] (arithmetic or enum type) stored by [Order] in sizeof(member) bytes.
+template <auto Member, ByteOrder Order=ByteOrder::BigEndian>
+struct ByteLayoutField
+{
+    using Struct = typename Detail::MemberPointerTraits<decltype(Member)>::Class;
+    using Value = typename Detail::MemberPointerTraits<decltype(Member)>::Member;
+    using Raw = typename Detail::LayoutRawType<Value>::Type;
+    static_assert(std::is_arithmetic_v<Raw> && !std::is_same_v<Raw, bool>,
+                  "ByteLayoutField: member must be arithmetic (not bool) or enum type.");
+
+    static constexpr std::size_t Size = sizeof(Value);
+
+        static
+        void
+        Decode(const Byte* buffer, Struct &value)
+        {
+            if constexpr (Order==ByteOrder::BigEndian)
+            {
+                value.*Member = static_cast<Value>(ToBigEndian<Raw>(buffer));
+            }
+            else
+            {
+                value.*Member = static_cast<Value>(ToLittleEndian<Raw>(buffer));
+            }
+        }
+
+        static
+        void
+        Encode(const Struct &value, Byte* buffer)
+        {
+            if constexpr (Order==ByteOrder::BigEndian)
+            {
+                WriteBigEndian(static_cast<Raw>(value.*Member), buffer);
+            }
+            else
+            {
+                WriteLittleEndian(static_cast<Raw>(value.*Member), buffer);
+            }
+        }
+};
+
+//! @brief Field of ByteLayout: [N] reserved bytes, skipped by decode and written as zero by encode.
+template <std::size_t N>
+struct ByteLayoutPadding
+{
+    static constexpr std::size_t Size = N;
+
+        template <typename Struct>
+        static
+        void
+        Decode(const Byte*, Struct &)
+        {
+        }
+
+        template <typename Struct>
+        static
+        void
+        Encode(const Struct &, Byte* buffer)
+        {
+            std::memset(buffer, 0, N);
+        }
+};
+
+//! @brief Compile time description of a fixed-size wire format of [Struct], fields are packed in order of [Fields].
+//! Offsets and total Size are constant expressions, decode and encode are unrolled to one load/store
+//! (plus byte swap for big endian) per field at fixed offset.
+//! @example
+//!     struct Header { uint16_t Type; uint32_t Length; uint64_t Timestamp; };
+//!     using HeaderLayout = ByteLayout<Header,
+//!         ByteLayoutField<&Header::Type>,
+//!         ByteLayoutPadding<2>,
+//!         ByteLayoutField<&Header::Length>,
+//!         ByteLayoutField<&Header::Timestamp, ByteOrder::LittleEndian>>;
+//!     static_assert(HeaderLayout::Size==16);
+//!     auto header = HeaderLayout::Read(reader); //'' one bounds check for whole header.
+template <typename Struct, typename... Fields>
+class ByteLayout
+{
+    static_assert((Detail::IsLayoutFieldOf<Fields, Struct>() && ...), "ByteLayout: field is member of other struct.");
+
+public:
+    static constexpr std::size_t Size = (std::size_t{0}+...+Fields::Size);
+
+    //! @brief Offset of each field in layout.
+    static constexpr std::array<std::size_t, sizeof...(Fields)> Offsets = []
+    {
+        std::array<std::size_t, sizeof...(Fields)> offsets{};
+        std::size_t offset = 0;
+        std::size_t i = 0;
+        ((offsets[i++] = offset, offset += Fields::Size), ...);
+        return offsets;
+    }();
+
+    //! @brief Decode from [buffer], which must have at least Size bytes.
+        static
+        void
+        DecodeUnchecked(const Byte* buffer, Struct &value)
+        {
+            DecodeFields(buffer, value, std::index_sequence_for<Fields...>{});
+        }
+
+    //! @throw std::runtime_error if [buffer] is smaller than Size.
+        static
+        Struct
+        Decode(std::span<const Byte> buffer)
+        {
+            if (buffer.size()<Size)
+            {
+                throw std::runtime_error("ByteLayout::Decode: buffer size ["+std::to_string(buffer.size())+"] is smaller than layout size ["+std::to_string(Size)+"].");
+            }
+            Struct value{};
+            DecodeUnchecked(buffer.data(), value);
+            return value;
+        }
+
+    //! @brief Decode from fixed size [buffer], size is checked at compile time.
+        template <std::size_t N>
+        static
+        Struct
+        Decode(const std::array<Byte, N> &buffer)
+        {
+            static_assert(N>=Size, "ByteLayout::Decode: buffer is smaller than layout size.");
+            Struct value{};
+            DecodeUnchecked(buffer.data(), value);
+            return value;
+        }
+
+    //! @brief Decode from current position of [reader] and advance it by Size.
+    //! @throw std::runtime_error if reader has less than Size bytes remaining.
+        static
+        Struct
+        Read(ByteReader &reader)
+        {
+            Struct value{};
+            DecodeUnchecked(reader.ReadSpan(Size).data(), value);
+            return value;
+        }
+
+    //! @brief Same as Read(reader) but decode into existing [value], e.g. element of array.
+    //! @note Faster than assigning returned struct, which is written by fields and then copied as whole.
+        static
+        void
+        Read(ByteReader &reader, Struct &value)
+        {
+            DecodeUnchecked(reader.ReadSpan(Size).data(), value);
+        }
+
+    //! @brief Decode consecutive values.size() structs from [reader] with one bounds check.
+        static
+        void
+        Read(ByteReader &reader, std::span<Struct> values)
+        {
+            const auto* buffer = reader.ReadSpan(values.size()*Size).data();
+            for (auto &value : values)
+            {
+                DecodeUnchecked(buffer, value);
+                buffer += Size;
+            }
+        }
+
+    //! @brief Encode to [buffer], which must have at least Size bytes.
+        static
+        void
+        EncodeUnchecked(const Struct &value, Byte* buffer)
+        {
+            EncodeFields(value, buffer, std::index_sequence_for<Fields...>{});
+        }
+
+    //! @throw std::runtime_error if [buffer] is smaller than Size.
+        static
+        void
+        Encode(const Struct &value, std::span<Byte> buffer)
+        {
+            if (buffer.size()<Size)
+            {
+                throw std::runtime_error("ByteLayout::Encode: buffer size ["+std::to_string(buffer.size())+"] is smaller than layout size ["+std::to_string(Size)+"].");
+            }
+            EncodeUnchecked(value, buffer.data());
+        }
+
+        static
+        std::array<Byte, Size>
+        Encode(const Struct &value)
+        {
+            std::array<Byte, Size> buffer;
+            EncodeUnchecked(value, buffer.data());
+            return buffer;
+        }
+
+    //! @brief Encode to current position of [writer] and advance it by Size.
+    //! @throw std::runtime_error if writer has less than Size bytes remaining.
+        static
+        void
+        Write(const Struct &value, ByteWriter &writer)
+        {
+            EncodeUnchecked(value, writer.WriteSpan(Size).data());
+        }
+
+private:
+        template <std::size_t... I>
+        static
+        void
+        DecodeFields(const Byte* buffer, Struct &value, std::index_sequence<I...>)
+        {
+            (Fields::Decode(buffer+Offsets[I], value), ...);
+        }
+
+        template <std::size_t... I>
+        static
+        void
+        EncodeFields(const Struct &value, Byte* buffer, std::index_sequence<I...>)
+        {
+            (Fields::Encode(value, buffer+Offsets[I]), ...);
+        }
+};
+
+}
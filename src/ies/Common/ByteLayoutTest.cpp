@@ -0,0 +1,108 @@
+#include "ies/Common/ByteLayout.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+enum class MessageType : std::uint16_t
+{
+    Data = 0x0102,
+    Ack = 0x0304,
+};
+
+struct Header
+{
+    MessageType Type;
+    std::uint32_t Length;
+    std::int64_t Timestamp;
+    double Value;
+    float Scale;
+};
+
+using HeaderLayout = ByteLayout<Header,
+    ByteLayoutField<&Header::Type>,
+    ByteLayoutPadding<2>,
+    ByteLayoutField<&Header::Length>,
+    ByteLayoutField<&Header::Timestamp, ByteOrder::LittleEndian>,
+    ByteLayoutField<&Header::Value>,
+    ByteLayoutField<&Header::Scale, ByteOrder::LittleEndian>>;
+
+static_assert(HeaderLayout::Size==28);
+static_assert(HeaderLayout::Offsets[4]==16);
+
+}
+
+TEST(ByteLayout, Decode)
+{
+    ByteArray buffer
+    {
+        0x03, 0x04, 0xEE, 0xEE,
+        0x00, 0x00, 0x01, 0x00,
+        0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x40,
+    };
+    auto header = HeaderLayout::Decode(buffer);
+    EXPECT_EQ(MessageType::Ack, header.Type);
+    EXPECT_EQ(256u, header.Length);
+    EXPECT_EQ(-2, header.Timestamp);
+    EXPECT_DOUBLE_EQ(1.5, header.Value);
+    EXPECT_FLOAT_EQ(2.5F, header.Scale);
+
+    //'' padding is written as zero.
+    auto encoded = HeaderLayout::Encode(header);
+    buffer[2] = 0;
+    buffer[3] = 0;
+    EXPECT_EQ(buffer, ByteArray(encoded.begin(), encoded.end()));
+    EXPECT_EQ(256u, HeaderLayout::Decode(encoded).Length);
+
+    ByteArray shortBuffer(HeaderLayout::Size-1);
+    EXPECT_THROW(HeaderLayout::Decode(shortBuffer), std::runtime_error);
+    ASSERT_THROW(HeaderLayout::Encode(header, shortBuffer), std::runtime_error);
+}
+
+TEST(ByteLayout, ReaderWriter)
+{
+    Header first{MessageType::Data, 7, 123456789, -0.25, 4.0F};
+    Header second{MessageType::Ack, 0xFFFFFFFFu, -1, 1e300, -1.0F};
+
+    ByteArray buffer(2*HeaderLayout::Size+1);
+    ByteWriter writer{buffer};
+    HeaderLayout::Write(first, writer);
+    HeaderLayout::Write(second, writer);
+    EXPECT_EQ(2*HeaderLayout::Size, writer.GetOffset());
+    EXPECT_THROW(HeaderLayout::Write(first, writer), std::runtime_error);
+
+    ByteReader reader{buffer};
+    for (auto &expect : {first, second})
+    {
+        auto header = HeaderLayout::Read(reader);
+        EXPECT_EQ(expect.Type, header.Type);
+        EXPECT_EQ(expect.Length, header.Length);
+        EXPECT_EQ(expect.Timestamp, header.Timestamp);
+        EXPECT_EQ(expect.Value, header.Value);
+        EXPECT_EQ(expect.Scale, header.Scale);
+    }
+    EXPECT_EQ(1u, reader.GetRemainingSize());
+    EXPECT_THROW(HeaderLayout::Read(reader), std::runtime_error);
+
+    reader.Seek(0);
+    std::vector<Header> headers(2);
+    HeaderLayout::Read(reader, headers);
+    EXPECT_EQ(second.Timestamp, headers[1].Timestamp);
+    reader.Seek(HeaderLayout::Size);
+    HeaderLayout::Read(reader, headers[0]);
+    EXPECT_EQ(second.Length, headers[0].Length);
+    reader.Seek(2);
+    ASSERT_THROW(HeaderLayout::Read(reader, headers), std::runtime_error);
+}
+
+}
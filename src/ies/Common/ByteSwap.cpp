@@ -0,0 +1,137 @@
+#include "ies/Common/ByteSwap.hpp"
+
+#include "ies/Common/Endian.hxx"
+#include "ies/Common/Simd.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if IES_SIMD_SSSE3 || IES_SIMD_AVX2
+#include <immintrin.h>
+#elif IES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace ies
+{
+
+namespace
+{
+
+//'' memcpy instead of reinterpret_cast, buffers can be unaligned.
+template <typename UInt>
+void
+SwapScalar(const Byte* source, Byte* destination, std::size_t count)
+{
+    for (std::size_t i = 0; i<count; ++i)
+    {
+        UInt value;
+        std::memcpy(&value, source+i*sizeof(UInt), sizeof(UInt));
+        value = Detail::ByteSwapUInt(value);
+        std::memcpy(destination+i*sizeof(UInt), &value, sizeof(UInt));
+    }
+}
+
+#if IES_SIMD_SSSE3
+
+//'' pshufb mask reversing each value in 16 bytes.
+template <typename UInt>
+__m128i
+MakeReverseMask()
+{
+    alignas(16) std::int8_t mask[16];
+    for (int i = 0; i<16; ++i)
+    {
+        constexpr int size = sizeof(UInt);
+        mask[i] = static_cast<std::int8_t>(i-i%size+(size-1-i%size));
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i*>(mask));
+}
+
+#elif IES_SIMD_SSE2
+
+//'' without pshufb: reorder 16-bit words by shuffle, then swap bytes in each word by shift.
+template <typename UInt>
+__m128i
+SwapVector(__m128i v)
+{
+    if constexpr (sizeof(UInt)==4)
+    {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+    }
+    else if constexpr (sizeof(UInt)==8)
+    {
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);
+    }
+    return _mm_or_si128(_mm_srli_epi16(v, 8), _mm_slli_epi16(v, 8));
+}
+
+#endif
+
+template <typename UInt>
+void
+SwapArray(const Byte* source, Byte* destination, std::size_t count)
+{
+    std::size_t i = 0;
+    auto byteCount = count*sizeof(UInt);
+#if IES_SIMD_AVX2
+    auto mask128 = MakeReverseMask<UInt>();
+    auto mask = _mm256_broadcastsi128_si256(mask128);
+    for (; i+32<=byteCount; i += 32)
+    {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source+i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination+i), _mm256_shuffle_epi8(v, mask));
+    }
+    for (; i+16<=byteCount; i += 16)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source+i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination+i), _mm_shuffle_epi8(v, mask128));
+    }
+#elif IES_SIMD_SSSE3
+    auto mask = MakeReverseMask<UInt>();
+    for (; i+16<=byteCount; i += 16)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source+i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination+i), _mm_shuffle_epi8(v, mask));
+    }
+#elif IES_SIMD_SSE2
+    for (; i+16<=byteCount; i += 16)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source+i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination+i), SwapVector<UInt>(v));
+    }
+#endif
+    //'' vector step is multiple of value size, so tail starts at value boundary.
+    SwapScalar<UInt>(source+i, destination+i, (byteCount-i)/sizeof(UInt));
+}
+
+}
+
+void
+ByteSwapArray(const Byte* source, Byte* destination, std::size_t count, std::size_t valueSize)
+{
+    switch (valueSize)
+    {
+        case 1:
+            if (source!=destination && count!=0)
+            {
+                std::memcpy(destination, source, count);
+            }
+            return;
+        case 2:
+            SwapArray<std::uint16_t>(source, destination, count);
+            return;
+        case 4:
+            SwapArray<std::uint32_t>(source, destination, count);
+            return;
+        case 8:
+            SwapArray<std::uint64_t>(source, destination, count);
+            return;
+        default:
+            throw std::runtime_error("ByteSwapArray: valueSize ["+std::to_string(valueSize)+"] is not 1, 2, 4 or 8.");
+    }
+}
+
+}
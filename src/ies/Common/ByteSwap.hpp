@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include "ies/ies_export.h"
+
+#include "ies/Common/Byte.hpp"
+
+#include <cstddef>
+
+#include <span>
+#include <type_traits>
+
+namespace ies
+{
+
+//! @brief Reverse bytes of each of [count] values of [valueSize] bytes from [source] to [destination].
+//! Kernel of bulk endian conversion: byte shuffle of 16 bytes (SSSE3/SSE2) or 32 bytes (AVX2) per step,
+//! remaining tail values by scalar byte swap. Buffers need no alignment.
+//! @note [source] and [destination] can be same buffer (in place), but must not partially overlap.
+//! @throw std::runtime_error if [valueSize] is not 1, 2, 4 or 8.
+IES_EXPORT
+void
+ByteSwapArray(const Byte* source, Byte* destination, std::size_t count, std::size_t valueSize);
+
+template <typename T>
+inline constexpr bool IsByteSwappable = std::is_arithmetic_v<T> && (sizeof(T)==1 || sizeof(T)==2 || sizeof(T)==4 || sizeof(T)==8);
+
+//! @brief Reverse bytes of each value in [values] in place, e.g. after reading raw big endian array from file.
+template <typename T>
+void
+ByteSwapInPlace(std::span<T> values)
+{
+    static_assert(IsByteSwappable<T>, "ByteSwapInPlace: T must be arithmetic type of size 1, 2, 4 or 8.");
+    auto* bytes = reinterpret_cast<Byte*>(values.data());
+    ByteSwapArray(bytes, bytes, values.size(), sizeof(T));
+}
+
+//! @brief Read values.size() big endian values T from [buffer] into [values].
+//! Same as values[i] = ToBigEndian<T>(buffer+i*sizeof(T)) for each value.
+//! @example
+//!     ByteArray buffer{0x01, 0x02, 0x03, 0x04};
+//!     std::vector<uint16_t> values(2);
+//!     ReadBigEndianArray<uint16_t>(buffer.data(), values);
+//!     //values = {0x0102, 0x0304}
+template <typename T>
+void
+ReadBigEndianArray(const Byte* buffer, std::span<T> values)
+{
+    static_assert(IsByteSwappable<T>, "ReadBigEndianArray: T must be arithmetic type of size 1, 2, 4 or 8.");
+    ByteSwapArray(buffer, reinterpret_cast<Byte*>(values.data()), values.size(), sizeof(T));
+}
+
+//! @brief Write [values] as big endian to [buffer], buffer must have values.size()*sizeof(T) bytes.
+template <typename T>
+void
+WriteBigEndianArray(std::span<const T> values, Byte* buffer)
+{
+    static_assert(IsByteSwappable<T>, "WriteBigEndianArray: T must be arithmetic type of size 1, 2, 4 or 8.");
+    ByteSwapArray(reinterpret_cast<const Byte*>(values.data()), buffer, values.size(), sizeof(T));
+}
+
+}
@@ -0,0 +1,100 @@
+#include "ies/Common/ByteSwap.hpp"
+
+#include "ies/Common/Endian.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+ByteArray
+MakeRandomBytes(std::size_t size)
+{
+    std::mt19937 generator{42};
+    ByteArray bytes(size);
+    for (auto &byte : bytes)
+    {
+        byte = static_cast<Byte>(generator());
+    }
+    return bytes;
+}
+
+//'' memcmp requires non-null pointers even for size 0, and data() of empty vector may be nullptr.
+bool
+IsSameBytes(const void* lhs, const void* rhs, std::size_t size)
+{
+    return size==0 || std::memcmp(lhs, rhs, size)==0;
+}
+
+//'' compare with ToBigEndian at all counts around vector steps and at unaligned buffer offset.
+template <typename T>
+void
+ExpectSameAsToBigEndian()
+{
+    auto bytes = MakeRandomBytes(sizeof(T)*100+3);
+    for (std::size_t offset : {0u, 1u, 3u})
+    {
+        for (std::size_t count = 0; count<=100; ++count)
+        {
+            std::vector<T> expect(count);
+            for (std::size_t i = 0; i<count; ++i)
+            {
+                expect[i] = ToBigEndian<T>(bytes.data()+offset+i*sizeof(T));
+            }
+
+            std::vector<T> values(count);
+            ReadBigEndianArray<T>(bytes.data()+offset, values);
+            ASSERT_TRUE(IsSameBytes(expect.data(), values.data(), count*sizeof(T))) << sizeof(T) << " " << offset << " " << count;
+
+            ByteArray written(count*sizeof(T));
+            WriteBigEndianArray<T>(values, written.data());
+            ASSERT_TRUE(IsSameBytes(bytes.data()+offset, written.data(), written.size()));
+
+            ByteSwapInPlace<T>(values);
+            ASSERT_TRUE(IsSameBytes(bytes.data()+offset, values.data(), written.size()));
+        }
+    }
+}
+
+}
+
+TEST(ByteSwap, ReadBigEndianArray)
+{
+    ByteArray buffer{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    std::vector<uint16_t> values16(4);
+    ReadBigEndianArray<uint16_t>(buffer.data(), values16);
+    std::vector<uint16_t> expect16{0x0102, 0x0304, 0x0506, 0x0708};
+    EXPECT_EQ(expect16, values16);
+
+    std::vector<uint32_t> values32(2);
+    ReadBigEndianArray<uint32_t>(buffer.data(), values32);
+    std::vector<uint32_t> expect32{0x01020304u, 0x05060708u};
+    EXPECT_EQ(expect32, values32);
+
+    std::vector<double> doubles(1);
+    ReadBigEndianArray<double>(buffer.data(), doubles);
+    EXPECT_DOUBLE_EQ(8.20788039913184e-304, doubles[0]);
+
+    ASSERT_THROW(ByteSwapArray(buffer.data(), buffer.data(), 2, 3), std::runtime_error);
+}
+
+TEST(ByteSwap, SameAsToBigEndian)
+{
+    ExpectSameAsToBigEndian<int8_t>();
+    ExpectSameAsToBigEndian<uint16_t>();
+    ExpectSameAsToBigEndian<int32_t>();
+    ExpectSameAsToBigEndian<uint64_t>();
+    ExpectSameAsToBigEndian<float>();
+    ASSERT_NO_FATAL_FAILURE(ExpectSameAsToBigEndian<double>());
+}
+
+}
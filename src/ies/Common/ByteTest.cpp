@@ -3,10 +3,61 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <random>
+#include <sstream>
 
 namespace ies
 {
 
+namespace
+{
+
+//'' straightforward format of ToString, one byte at a time.
+std::string
+ToStringByByte(const ByteArray &byteArray, std::size_t begin, std::size_t end)
+{
+    auto toHex = [](std::size_t value)
+    {
+        std::string hex;
+        do
+        {
+            hex.insert(hex.begin(), "0123456789ABCDEF"[value%16]);
+            value /= 16;
+        }
+        while (value!=0);
+        return hex;
+    };
+
+    auto s = "ByteArray {unnamed}, range ["+std::to_string(begin)+", "+std::to_string(end)+"), size ["+std::to_string(end-begin)+"]:\n"
+             "|00 01 02 03 04 05 06 07|08 09 0A 0B 0C 0D 0E 0F| Line Offset\n"
+             "+-----------------------+-----------------------+\n";
+    if (begin==end)
+    {
+        return s;
+    }
+    for (auto line = begin/16; line<(end+15)/16; ++line)
+    {
+        for (std::size_t column = 0; column<16; ++column)
+        {
+            s += (column%8==0) ? '|' : ' ';
+            auto i = line*16+column;
+            if (i>=begin && i<end)
+            {
+                auto hex = toHex(byteArray[i]);
+                s += (hex.size()==1) ? "0"+hex : hex;
+            }
+            else
+            {
+                s += "  ";
+            }
+        }
+        s += "| "+toHex(line)+"0\n";
+    }
+    return s;
+}
+
+}
+
 TEST(Byte, EmptyArray)
 {
     ByteArray emptyArray;
@@ -180,4 +231,43 @@ TEST(Byte, CArray)
     ASSERT_EQ(expectArrayString, ToString(reinterpret_cast<Byte*>(&array), 0, size));
 }
 
+TEST(Byte, SameAsByByte)
+{
+    std::mt19937 generator{42};
+    ByteArray byteArray(5000);
+    for (auto &byte : byteArray)
+    {
+        byte = static_cast<Byte>(generator());
+    }
+    std::uniform_int_distribution<std::size_t> indexDistribution{0, byteArray.size()};
+    for (int i = 0; i<200; ++i)
+    {
+        auto begin = indexDistribution(generator);
+        auto end = indexDistribution(generator);
+        if (begin>end)
+        {
+            std::swap(begin, end);
+        }
+        ASSERT_EQ(ToStringByByte(byteArray, begin, end), ToString(byteArray, begin, end)) << begin << " " << end;
+    }
+    ASSERT_EQ(ToStringByByte(byteArray, 0, byteArray.size()), ToString(byteArray));
+}
+
+TEST(Byte, WriteByteArray)
+{
+    //'' more than one chunk of lines.
+    ByteArray byteArray(16*5000+7);
+    for (std::size_t i = 0; i<byteArray.size(); ++i)
+    {
+        byteArray[i] = static_cast<Byte>(i*31);
+    }
+    std::ostringstream stream;
+    WriteByteArray(stream, byteArray.data(), 3, byteArray.size(), "big");
+    EXPECT_EQ(ToString(byteArray, 3, byteArray.size(), "big"), stream.str());
+
+    std::ostringstream emptyStream;
+    WriteByteArray(emptyStream, byteArray.data(), 9, 3);
+    ASSERT_EQ(ToString(byteArray, 9, 3), emptyStream.str());
+}
+
 }
@@ -2,12 +2,86 @@
 //! [C++11 Compatible]
 #include "ies/StdUtil/RequireCpp11.hpp" // IWYU pragma: keep
 
+#include <cstdint>
 #include <cstring>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
 
 #include "ies/Common/Byte.hpp"
 
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace ies { namespace Detail {
+
+inline
+std::uint16_t
+ByteSwapUInt(std::uint16_t value)
+{
+    return static_cast<std::uint16_t>((value>>8)|(value<<8));
+}
+
+inline
+std::uint32_t
+ByteSwapUInt(std::uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#else
+    return ((value&0xFFu)<<24)|((value&0xFF00u)<<8)|((value>>8)&0xFF00u)|(value>>24);
+#endif
+}
+
+inline
+std::uint64_t
+ByteSwapUInt(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return (static_cast<std::uint64_t>(ByteSwapUInt(static_cast<std::uint32_t>(value)))<<32)
+           |ByteSwapUInt(static_cast<std::uint32_t>(value>>32));
+#endif
+}
+
+//'' reverse bytes of [p] with size n. Size 2, 4, 8 swap as unsigned integer to use bswap instruction.
+template <std::size_t n>
+struct ReverseBytes
+{
+    static void Apply(char* p)
+    {
+        for (std::size_t i = 0; i<n/2; ++i)
+        {
+            std::swap(p[i], p[n-i-1]);
+        }
+    }
+};
+
+template <typename UInt>
+struct ReverseBytesAsUInt
+{
+    static void Apply(char* p)
+    {
+        UInt value;
+        std::memcpy(&value, p, sizeof(UInt));
+        value = ByteSwapUInt(value);
+        std::memcpy(p, &value, sizeof(UInt));
+    }
+};
+
+template <> struct ReverseBytes<2> : ReverseBytesAsUInt<std::uint16_t> {};
+template <> struct ReverseBytes<4> : ReverseBytesAsUInt<std::uint32_t> {};
+template <> struct ReverseBytes<8> : ReverseBytesAsUInt<std::uint64_t> {};
+
+}}
+
 //'' This header assumes system using little endian.
-//'' i.e. behavior of reinterpret_cast result same as little endian.
+//'' i.e. bytes copied into T by memcpy are read as little endian value.
 namespace ies
 {
 
@@ -17,20 +91,16 @@ namespace ies
 //!     ByteArray buffer{0x01, 0x02, 0x03, 0x04};
 //!     auto bigEndian = ToBigEndian<uint32_t>(buffer);
 //!     //bigEndian = 0x01020304
-//!     auto littleEndian = *reinterpret_cast<const uint32_t*>(buffer.data());
+//!     auto littleEndian = ToLittleEndian<uint32_t>(buffer.data());
 //!     //littleEndian = 0x04030201
 template <typename T>
 T
 ToBigEndian(const Byte* buffer)
 {
-    constexpr auto size = sizeof(T);
     T value = 0;
     auto* p = reinterpret_cast<char*>(&value);
-    std::memcpy(p, buffer, size);
-    for (std::size_t i = 0; i<size/2; ++i)
-    {
-        std::swap(p[i], p[size-i-1]);
-    }
+    std::memcpy(p, buffer, sizeof(T));
+    Detail::ReverseBytes<sizeof(T)>::Apply(p);
     return value;
 }
 
@@ -45,16 +115,19 @@ ToBigEndian(const Byte* buffer, std::size_t &offset)
 }
 
 //! @brief Read buffer[0] by n byte as little endian value T, n is size of T.
-//! Just a convenient wrapper to save boilerplate reinterpret when reading little endian in buffer.
+//! Just a convenient wrapper to save boilerplate when reading little endian in buffer.
+//! @note Read by memcpy, buffer does not need alignment of T.
 template <typename T>
 T
 ToLittleEndian(const Byte* buffer)
 {
-    return *reinterpret_cast<const T*>(buffer);
+    T value;
+    std::memcpy(&value, buffer, sizeof(T));
+    return value;
 }
 
 //! @brief Read buffer[offset] by n byte as little endian value T, n is size of T. And then increase offset by n.
-//! Just a convenient wrapper to save boilerplate reinterpret when reading little endian in buffer.
+//! @note Read by memcpy, buffer does not need alignment of T.
 template <typename T>
 T
 ToLittleEndian(const Byte* buffer, std::size_t &offset)
@@ -64,4 +137,22 @@ ToLittleEndian(const Byte* buffer, std::size_t &offset)
     return value;
 }
 
+//! @brief Write [value] to buffer[0] by n byte as big endian, n is size of T.
+template <typename T>
+void
+WriteBigEndian(T value, Byte* buffer)
+{
+    auto* p = reinterpret_cast<char*>(&value);
+    Detail::ReverseBytes<sizeof(T)>::Apply(p);
+    std::memcpy(buffer, p, sizeof(T));
+}
+
+//! @brief Write [value] to buffer[0] by n byte as little endian, n is size of T.
+template <typename T>
+void
+WriteLittleEndian(T value, Byte* buffer)
+{
+    std::memcpy(buffer, &value, sizeof(T));
+}
+
 }
@@ -136,4 +136,28 @@ TEST(Endian, ToLittleEndianWithOffset)
     ASSERT_EQ(8u, offset);
 }
 
+TEST(Endian, ToLittleEndianUnaligned)
+{
+    ByteArray buffer{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    auto littleEndian = ToLittleEndian<uint64_t>(buffer.data()+1);
+    ASSERT_EQ(0x0807060504030201ull, littleEndian);
+}
+
+TEST(Endian, WriteEndian)
+{
+    ByteArray buffer(5);
+    WriteBigEndian<uint32_t>(0x01020304u, buffer.data()+1);
+    ByteArray expect{0x00, 0x01, 0x02, 0x03, 0x04};
+    EXPECT_EQ(expect, buffer);
+    EXPECT_EQ(0x01020304u, ToBigEndian<uint32_t>(buffer.data()+1));
+
+    WriteLittleEndian<uint32_t>(0x01020304u, buffer.data()+1);
+    expect = {0x00, 0x04, 0x03, 0x02, 0x01};
+    EXPECT_EQ(expect, buffer);
+
+    ByteArray doubleBuffer(sizeof(double));
+    WriteBigEndian<double>(-1.5, doubleBuffer.data());
+    ASSERT_DOUBLE_EQ(-1.5, ToBigEndian<double>(doubleBuffer.data()));
+}
+
 }
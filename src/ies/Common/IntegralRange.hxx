@@ -9,8 +9,10 @@
 #pragma warning(disable: 4127)
 #endif
 
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
+#include <limits>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -19,6 +21,10 @@
 #include "ies/Common/RangeSide.hpp"
 #include "ies/Common/SmartEnum.hxx"
 
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
 //! @brief IntegralRange: a range [beginValue, endValue) of integral types.
 //! Type satisfy std::is_integral, e.g. int, unsigned long long.
 //! Default is iterating forwardly, can use RangeDirection::Reverse to iterating reverserly.
@@ -40,87 +46,180 @@
 //! // result: 01234
 //! for (auto i : ReverseIntRange(0, 5)) { std::cout << i; }
 //! // result: 43210 NOT 54321!! since range is [0, 5), not (0, 5]
+//!
+//! @note Iterator is random access for std::ranges, std::ranges::distance and std::ranges::lower_bound are O(1) and O(log n) steps.
+//! Legacy std algorithms see input iterator (same as std::ranges::iota_view), so std::distance is O(n).
+//! In C++20 IntegralRange is std::ranges::view and std::ranges::borrowed_range,
+//! e.g. IntRange(0, 10) | std::views::filter(IsOdd).
 
 // NOLINTNEXTLINE(modernize-concat-nested-namespaces)
 namespace ies { namespace Detail {
 
-template <typename IntType>
+//! @brief Random access iterator of IntegralRange, Step is +1 (Forward) or -1 (Reverse).
+//! Dereference returns value (not reference), iterator holds no pointer to range so it stays valid after range is gone.
+//! Values advance in modular arithmetic of unsigned IntType, so Reverse end of [0, n) (one before 0) is still reachable.
+//! @note Same as std::ranges::iota_view: iterator_concept is random access (std::ranges algorithms),
+//! iterator_category is input since reference is prvalue, which does not meet C++17 forward iterator requirements.
+//! @note Distance is exact for IntType narrower than difference_type, otherwise range size must fit in difference_type.
+template <typename IntType, int Step>
 class IntegralRangeIterator
 {
 public:
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
     using value_type = IntType;
     using difference_type = std::ptrdiff_t;
-    using pointer = IntType*;
-    using reference = IntType&;
+    using pointer = void;
+    using reference = IntType;
+
+        IntegralRangeIterator()
+        :   mCurrent(0)
+        {}
 
-        IntegralRangeIterator(IntType current)
+        explicit IntegralRangeIterator(IntType current)
         :   mCurrent(current)
         {}
 
-        bool
-        operator==(const IntegralRangeIterator &rhs)
+        IntType
+        operator*()
         const
         {
-            return mCurrent==rhs.mCurrent;
+            return mCurrent;
         }
 
-        bool
-        operator!=(const IntegralRangeIterator &rhs)
+        IntType
+        operator[](difference_type n)
         const
         {
-            return !(*this==rhs);
+            return Advance(mCurrent, n);
         }
 
-        IntType &
-        operator*()
+        IntegralRangeIterator &
+        operator++()
         {
-            return mCurrent;
+            if (Step>0) { ++mCurrent; }
+            else { --mCurrent; }
+            return *this;
         }
 
-        const IntType &
-        operator*()
-        const
+        IntegralRangeIterator
+        operator++(int)
         {
-            return mCurrent;
+            auto copy = *this;
+            ++*this;
+            return copy;
         }
 
-protected:
-    IntType mCurrent;
-};
+        IntegralRangeIterator &
+        operator--()
+        {
+            if (Step>0) { --mCurrent; }
+            else { ++mCurrent; }
+            return *this;
+        }
 
-template <typename IntType>
-class IntegralRangeForwardIterator : public IntegralRangeIterator<IntType>
-{
-public:
-        IntegralRangeForwardIterator(IntType current)
-        :   IntegralRangeIterator<IntType>(current)
-        {}
+        IntegralRangeIterator
+        operator--(int)
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
 
-        IntegralRangeForwardIterator<IntType> &
-        operator++()
+        IntegralRangeIterator &
+        operator+=(difference_type n)
         {
-            ++(this->mCurrent);
+            mCurrent = Advance(mCurrent, n);
             return *this;
         }
-};
-
-template <typename IntType>
-class IntegralRangeReverseIterator : public IntegralRangeIterator<IntType>
-{
-public:
-        IntegralRangeReverseIterator(IntType current)
-        :   IntegralRangeIterator<IntType>(current)
-        {}
 
-        IntegralRangeReverseIterator<IntType> &
-        operator++()
+        IntegralRangeIterator &
+        operator-=(difference_type n)
         {
-            --(this->mCurrent);
+            mCurrent = Advance(mCurrent, -n);
             return *this;
         }
+
+        friend
+        IntegralRangeIterator
+        operator+(IntegralRangeIterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend
+        IntegralRangeIterator
+        operator+(difference_type n, IntegralRangeIterator it)
+        {
+            return it += n;
+        }
+
+        friend
+        IntegralRangeIterator
+        operator-(IntegralRangeIterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend
+        difference_type
+        operator-(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs)
+        {
+            const auto &from = Step>0 ? rhs.mCurrent : lhs.mCurrent;
+            const auto &to = Step>0 ? lhs.mCurrent : rhs.mCurrent;
+            if (sizeof(IntType)<sizeof(difference_type))
+            {
+                return ToPosition(to)-ToPosition(from);
+            }
+            //'' IntType as wide as difference_type: modular difference, right whenever distance fits difference_type.
+            using UIntType = typename std::make_unsigned<IntType>::type;
+            return static_cast<difference_type>(static_cast<UIntType>(static_cast<UIntType>(to)-static_cast<UIntType>(from)));
+        }
+
+        friend bool operator==(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return lhs.mCurrent==rhs.mCurrent; }
+        friend bool operator!=(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return !(lhs==rhs); }
+        friend bool operator<(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return lhs-rhs<0; }
+        friend bool operator>(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return rhs<lhs; }
+        friend bool operator<=(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return !(rhs<lhs); }
+        friend bool operator>=(const IntegralRangeIterator &lhs, const IntegralRangeIterator &rhs) { return !(lhs<rhs); }
+
+private:
+    IntType mCurrent;
+
+    //'' value of IntType narrower than difference_type, widened before subtracting so distance does not wrap.
+    //'' Reverse end wrapped from min to max is min-1: max is never a value of Reverse range [begin, end<=max).
+        static
+        difference_type
+        ToPosition(IntType value)
+        {
+            if (Step<0 && value==std::numeric_limits<IntType>::max())
+            {
+                return static_cast<difference_type>(std::numeric_limits<IntType>::min())-1;
+            }
+            return static_cast<difference_type>(value);
+        }
+
+    //'' value n steps after in iterating direction, by unsigned arithmetic to wrap instead of overflow.
+        static
+        IntType
+        Advance(IntType value, difference_type n)
+        {
+            using UIntType = typename std::make_unsigned<IntType>::type;
+            auto offset = static_cast<UIntType>(n);
+            if (Step>0)
+            {
+                return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(value)+offset));
+            }
+            return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(value)-offset));
+        }
 };
 
+template <typename IntType>
+using IntegralRangeForwardIterator = IntegralRangeIterator<IntType, 1>;
+
+template <typename IntType>
+using IntegralRangeReverseIterator = IntegralRangeIterator<IntType, -1>;
+
 }}
 
 namespace ies
@@ -361,6 +460,15 @@ using ReverseIndexRange = ies::IntegralRange<std::size_t, ies::RangeDirection::R
 
 }
 
+#if __cplusplus >= 202002L
+//'' IntegralRange is cheap to copy and its iterators do not refer to it.
+template <typename IntType, ies::RangeDirection Direction>
+inline constexpr bool std::ranges::enable_view<ies::IntegralRange<IntType, Direction>> = true;
+
+template <typename IntType, ies::RangeDirection Direction>
+inline constexpr bool std::ranges::enable_borrowed_range<ies::IntegralRange<IntType, Direction>> = true;
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -0,0 +1,303 @@
+#include "ies/Common/IntegralRangeBulk.hpp"
+
+#include "ies/Common/Simd.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#if IES_SIMD_AVX2
+#include <immintrin.h>
+#elif IES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace ies
+{
+
+namespace
+{
+
+//'' unsigned compare by signed compare instruction: flip sign bit of both sides.
+template <typename T>
+constexpr T SignBit = static_cast<T>(std::make_unsigned_t<T>{1}<<(sizeof(T)*8-1));
+
+#if IES_SIMD_AVX2
+
+struct Avx2x32
+{
+    using Reg = __m256i;
+    static constexpr std::size_t Lanes = 8;
+
+    template <typename T>
+    static Reg Load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    template <typename T>
+    static void Store(T* p, Reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    template <typename T>
+    static Reg Set1(T value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+    static Reg Sub(Reg a, Reg b) { return _mm256_sub_epi32(a, b); }
+    static Reg Xor(Reg a, Reg b) { return _mm256_xor_si256(a, b); }
+    static Reg CmpGt(Reg a, Reg b) { return _mm256_cmpgt_epi32(a, b); }
+    static Reg Select(Reg mask, Reg a, Reg b) { return _mm256_blendv_epi8(b, a, mask); }
+    static unsigned MoveMask(Reg mask) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))); }
+};
+
+struct Avx2x64
+{
+    using Reg = __m256i;
+    static constexpr std::size_t Lanes = 4;
+
+    template <typename T>
+    static Reg Load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    template <typename T>
+    static void Store(T* p, Reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    template <typename T>
+    static Reg Set1(T value) { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+    static Reg Sub(Reg a, Reg b) { return _mm256_sub_epi64(a, b); }
+    static Reg Xor(Reg a, Reg b) { return _mm256_xor_si256(a, b); }
+    static Reg CmpGt(Reg a, Reg b) { return _mm256_cmpgt_epi64(a, b); }
+    static Reg Select(Reg mask, Reg a, Reg b) { return _mm256_blendv_epi8(b, a, mask); }
+    static unsigned MoveMask(Reg mask) { return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(mask))); }
+};
+
+template <std::size_t Size>
+struct SimdOfSize { using Type = void; };
+template <>
+struct SimdOfSize<4> { using Type = Avx2x32; };
+template <>
+struct SimdOfSize<8> { using Type = Avx2x64; };
+
+#elif IES_SIMD_SSE2
+
+//'' SSE2 has no 64-bit compare (SSE4.2), 64-bit values use scalar loop.
+struct Sse2x32
+{
+    using Reg = __m128i;
+    static constexpr std::size_t Lanes = 4;
+
+    template <typename T>
+    static Reg Load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    template <typename T>
+    static void Store(T* p, Reg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    template <typename T>
+    static Reg Set1(T value) { return _mm_set1_epi32(static_cast<int>(value)); }
+    static Reg Sub(Reg a, Reg b) { return _mm_sub_epi32(a, b); }
+    static Reg Xor(Reg a, Reg b) { return _mm_xor_si128(a, b); }
+    static Reg CmpGt(Reg a, Reg b) { return _mm_cmpgt_epi32(a, b); }
+    static Reg Select(Reg mask, Reg a, Reg b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+    static unsigned MoveMask(Reg mask) { return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(mask))); }
+};
+
+template <std::size_t Size>
+struct SimdOfSize { using Type = void; };
+template <>
+struct SimdOfSize<4> { using Type = Sse2x32; };
+
+#else
+
+template <std::size_t Size>
+struct SimdOfSize { using Type = void; };
+
+#endif
+
+template <typename T>
+using SimdOf = typename SimdOfSize<sizeof(T)>::Type;
+
+//'' IsInRange as one unsigned compare: v-begin wraps around to large value when v<begin.
+template <typename T>
+bool
+IsInRangeScalar(T value, T begin, T end)
+{
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(value)-static_cast<U>(begin))<static_cast<U>(static_cast<U>(end)-static_cast<U>(begin));
+}
+
+//'' bit i is IsInRange(values[i]) for count (at most 64) values.
+template <typename T>
+std::uint64_t
+MaskWord(const T* values, std::size_t count, T begin, T end)
+{
+    std::uint64_t word = 0;
+    std::size_t i = 0;
+    using V = SimdOf<T>;
+    if constexpr (!std::is_void_v<V>)
+    {
+        if (count==64)
+        {
+            using U = std::make_unsigned_t<T>;
+            auto size = static_cast<T>(static_cast<U>(end)-static_cast<U>(begin));
+            auto beginReg = V::Set1(begin);
+            auto signBit = V::Set1(SignBit<T>);
+            auto biasedSize = V::Set1(static_cast<T>(size^SignBit<T>));
+            for (; i<64; i += V::Lanes)
+            {
+                auto offset = V::Xor(V::Sub(V::Load(values+i), beginReg), signBit);
+                word |= std::uint64_t{V::MoveMask(V::CmpGt(biasedSize, offset))}<<i;
+            }
+            return word;
+        }
+    }
+    for (; i<count; ++i)
+    {
+        word |= std::uint64_t{IsInRangeScalar(values[i], begin, end)}<<i;
+    }
+    return word;
+}
+
+template <typename T>
+std::size_t
+CountInRangeImpl(T begin, T end, std::span<const T> values)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i<values.size(); i += 64)
+    {
+        auto size = std::min<std::size_t>(64, values.size()-i);
+        count += static_cast<std::size_t>(std::popcount(MaskWord(values.data()+i, size, begin, end)));
+    }
+    return count;
+}
+
+template <typename T>
+void
+MaskInRangeImpl(T begin, T end, std::span<const T> values, std::span<std::uint64_t> mask)
+{
+    auto wordCount = (values.size()+63)/64;
+    if (mask.size()<wordCount)
+    {
+        throw std::runtime_error("MaskInRange: mask size ["+std::to_string(mask.size())+"] is less than ["
+                                 +std::to_string(wordCount)+"] words for ["+std::to_string(values.size())+"] values.");
+    }
+    for (std::size_t w = 0; w<wordCount; ++w)
+    {
+        auto i = w*64;
+        mask[w] = MaskWord(values.data()+i, std::min<std::size_t>(64, values.size()-i), begin, end);
+    }
+}
+
+//'' clamp to [low, high], low<=high.
+template <typename T>
+void
+ClampImpl(T low, T high, std::span<const T> values, std::span<T> clamped, const char* functionName)
+{
+    if (clamped.size()<values.size())
+    {
+        throw std::runtime_error(std::string{functionName}+": output size ["+std::to_string(clamped.size())
+                                 +"] is smaller than values size ["+std::to_string(values.size())+"].");
+    }
+    const auto* source = values.data();
+    auto* destination = clamped.data();
+    std::size_t i = 0;
+    using V = SimdOf<T>;
+    if constexpr (!std::is_void_v<V>)
+    {
+        //'' signed values compare directly, unsigned values compare with sign bit flipped.
+        constexpr T bias = std::is_signed_v<T> ? T{0} : SignBit<T>;
+        auto biasReg = V::Set1(bias);
+        auto lowReg = V::Set1(low);
+        auto highReg = V::Set1(high);
+        auto biasedLow = V::Set1(static_cast<T>(low^bias));
+        auto biasedHigh = V::Set1(static_cast<T>(high^bias));
+        for (; i+V::Lanes<=values.size(); i += V::Lanes)
+        {
+            auto v = V::Load(source+i);
+            auto biased = V::Xor(v, biasReg);
+            v = V::Select(V::CmpGt(biased, biasedHigh), highReg, v);
+            v = V::Select(V::CmpGt(biasedLow, biased), lowReg, v);
+            V::Store(destination+i, v);
+        }
+    }
+    for (; i<values.size(); ++i)
+    {
+        destination[i] = std::min(std::max(source[i], low), high);
+    }
+}
+
+template <typename T>
+void
+ClampToRangeImpl(const IntegralRange<T> &range, std::span<const T> values, std::span<T> clamped)
+{
+    //'' not empty() or GetMax(), size() overflows IntType for wide range, e.g. [INT_MIN, 0).
+    if (range.GetBegin()==range.GetEnd())
+    {
+        throw std::runtime_error("ClampToRange: cannot clamp to empty range "+ToString(range)+".");
+    }
+    ClampImpl(range.GetBegin(), range.GetEnd()-1, values, clamped, "ClampToRange");
+}
+
+}
+
+std::size_t
+CountInRange(const IntRange &range, std::span<const int> values)
+{
+    return CountInRangeImpl(range.GetBegin(), range.GetEnd(), values);
+}
+
+std::size_t
+CountInRange(const UIntRange &range, std::span<const unsigned int> values)
+{
+    return CountInRangeImpl(range.GetBegin(), range.GetEnd(), values);
+}
+
+std::size_t
+CountInRange(const IndexRange &range, std::span<const std::size_t> values)
+{
+    return CountInRangeImpl(range.GetBegin(), range.GetEnd(), values);
+}
+
+void
+MaskInRange(const IntRange &range, std::span<const int> values, std::span<std::uint64_t> mask)
+{
+    MaskInRangeImpl(range.GetBegin(), range.GetEnd(), values, mask);
+}
+
+void
+MaskInRange(const UIntRange &range, std::span<const unsigned int> values, std::span<std::uint64_t> mask)
+{
+    MaskInRangeImpl(range.GetBegin(), range.GetEnd(), values, mask);
+}
+
+void
+MaskInRange(const IndexRange &range, std::span<const std::size_t> values, std::span<std::uint64_t> mask)
+{
+    MaskInRangeImpl(range.GetBegin(), range.GetEnd(), values, mask);
+}
+
+void
+ClampToRange(const IntRange &range, std::span<const int> values, std::span<int> clamped)
+{
+    ClampToRangeImpl(range, values, clamped);
+}
+
+void
+ClampToRange(const UIntRange &range, std::span<const unsigned int> values, std::span<unsigned int> clamped)
+{
+    ClampToRangeImpl(range, values, clamped);
+}
+
+void
+ClampToRange(const IndexRange &range, std::span<const std::size_t> values, std::span<std::size_t> clamped)
+{
+    ClampToRangeImpl(range, values, clamped);
+}
+
+void
+FindClosest(const IntRange &range, std::span<const int> values, std::span<int> closest)
+{
+    ClampImpl(range.GetBegin(), range.GetEnd(), values, closest, "FindClosest");
+}
+
+void
+FindClosest(const UIntRange &range, std::span<const unsigned int> values, std::span<unsigned int> closest)
+{
+    ClampImpl(range.GetBegin(), range.GetEnd(), values, closest, "FindClosest");
+}
+
+void
+FindClosest(const IndexRange &range, std::span<const std::size_t> values, std::span<std::size_t> closest)
+{
+    ClampImpl(range.GetBegin(), range.GetEnd(), values, closest, "FindClosest");
+}
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <span>
+
+#include "ies/Common/IntegralRange.hxx"
+
+namespace ies
+{
+
+//! @brief Bulk versions of IntegralRange predicates over arrays of int, unsigned int and std::size_t.
+//! Branchless SIMD kernels: 4 (SSE2) or 8 (AVX2) values per step for 32-bit types,
+//! 4 values per step (AVX2 only) for std::size_t, scalar for tail. Arrays need no alignment.
+//! @example
+//!     std::vector<int> column = LoadColumn();
+//!     std::vector<std::uint64_t> mask((column.size()+63)/64);
+//!     MaskInRange(IntRange{0, 100}, column, mask);
+
+//! @brief Count values v with range.IsInRange(v).
+IES_EXPORT
+std::size_t
+CountInRange(const IntRange &range, std::span<const int> values);
+
+IES_EXPORT
+std::size_t
+CountInRange(const UIntRange &range, std::span<const unsigned int> values);
+
+IES_EXPORT
+std::size_t
+CountInRange(const IndexRange &range, std::span<const std::size_t> values);
+
+//! @brief Set bit i of mask (bit i%64 of mask[i/64]) to range.IsInRange(values[i]), bits after values.size() are cleared.
+//! @throw std::runtime_error if mask has less than (values.size()+63)/64 words.
+IES_EXPORT
+void
+MaskInRange(const IntRange &range, std::span<const int> values, std::span<std::uint64_t> mask);
+
+IES_EXPORT
+void
+MaskInRange(const UIntRange &range, std::span<const unsigned int> values, std::span<std::uint64_t> mask);
+
+IES_EXPORT
+void
+MaskInRange(const IndexRange &range, std::span<const std::size_t> values, std::span<std::uint64_t> mask);
+
+//! @brief Nearest value in range of each value: clamped[i] = min(max(values[i], range.GetMin()), range.GetMax()).
+//! @note [clamped] can be same array as [values].
+//! @throw std::runtime_error if range is empty or clamped is smaller than values.
+IES_EXPORT
+void
+ClampToRange(const IntRange &range, std::span<const int> values, std::span<int> clamped);
+
+IES_EXPORT
+void
+ClampToRange(const UIntRange &range, std::span<const unsigned int> values, std::span<unsigned int> clamped);
+
+IES_EXPORT
+void
+ClampToRange(const IndexRange &range, std::span<const std::size_t> values, std::span<std::size_t> clamped);
+
+//! @brief Same as closest[i] = range.FindClosest(values[i]), i.e. clamp to [begin, end] including the end.
+//! @note [closest] can be same array as [values].
+//! @throw std::runtime_error if closest is smaller than values.
+IES_EXPORT
+void
+FindClosest(const IntRange &range, std::span<const int> values, std::span<int> closest);
+
+IES_EXPORT
+void
+FindClosest(const UIntRange &range, std::span<const unsigned int> values, std::span<unsigned int> closest);
+
+IES_EXPORT
+void
+FindClosest(const IndexRange &range, std::span<const std::size_t> values, std::span<std::size_t> closest);
+
+}
@@ -0,0 +1,113 @@
+#include "ies/Common/IntegralRangeBulk.hpp"
+
+#include <cstdint>
+
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+namespace
+{
+
+//'' random values around range and extreme values of T, size not multiple of any vector width.
+template <typename T>
+std::vector<T>
+MakeValues(const IntegralRange<T> &range, std::size_t size)
+{
+    std::mt19937_64 generator{5};
+    std::uniform_int_distribution<long long> distribution{-20, 20};
+    std::vector<T> values;
+    for (std::size_t i = 0; i<size; ++i)
+    {
+        auto base = (i%2==0) ? range.GetBegin() : range.GetEnd();
+        //'' wrap around instead of signed overflow at extreme values.
+        using U = std::make_unsigned_t<T>;
+        values.push_back(static_cast<T>(static_cast<U>(base)+static_cast<U>(distribution(generator))));
+    }
+    values.push_back(std::numeric_limits<T>::min());
+    values.push_back(std::numeric_limits<T>::max());
+    values.push_back(T{0});
+    return values;
+}
+
+template <typename T>
+void
+ExpectSameAsScalar(const IntegralRange<T> &range)
+{
+    for (std::size_t size : {0u, 1u, 7u, 64u, 200u, 1000u})
+    {
+        auto values = MakeValues(range, size);
+
+        std::size_t expectedCount = 0;
+        std::vector<std::uint64_t> expectedMask((values.size()+63)/64);
+        std::vector<T> expectedClamped;
+        std::vector<T> expectedClosest;
+        for (std::size_t i = 0; i<values.size(); ++i)
+        {
+            if (range.IsInRange(values[i]))
+            {
+                ++expectedCount;
+                expectedMask[i/64] |= std::uint64_t{1}<<(i%64);
+            }
+            expectedClamped.push_back(std::min(std::max(values[i], range.GetBegin()), static_cast<T>(range.GetEnd()-1)));
+            expectedClosest.push_back(range.FindClosest(values[i]));
+        }
+
+        EXPECT_EQ(expectedCount, CountInRange(range, std::span<const T>{values}));
+
+        std::vector<std::uint64_t> mask(expectedMask.size(), ~std::uint64_t{0});
+        MaskInRange(range, std::span<const T>{values}, mask);
+        EXPECT_EQ(expectedMask, mask);
+
+        std::vector<T> clamped(values.size());
+        ClampToRange(range, std::span<const T>{values}, clamped);
+        EXPECT_EQ(expectedClamped, clamped);
+
+        auto closest = values;
+        FindClosest(range, std::span<const T>{closest}, closest);
+        EXPECT_EQ(expectedClosest, closest);
+    }
+}
+
+}
+
+TEST(IntegralRangeBulk, Int)
+{
+    ExpectSameAsScalar(IntRange{-5, 10});
+    ExpectSameAsScalar(IntRange{std::numeric_limits<int>::min(), 0});
+    ExpectSameAsScalar(IntRange{-1, std::numeric_limits<int>::max()});
+}
+
+TEST(IntegralRangeBulk, UnsignedInt)
+{
+    ExpectSameAsScalar(UIntRange{3, 40});
+    ExpectSameAsScalar(UIntRange{0, 0x80000010u});
+    ExpectSameAsScalar(UIntRange{0x7FFFFFF0u, std::numeric_limits<unsigned int>::max()});
+}
+
+TEST(IntegralRangeBulk, Index)
+{
+    ExpectSameAsScalar(IndexRange{100, 1000});
+    ExpectSameAsScalar(IndexRange{0, (std::size_t{1}<<63)+5});
+    ExpectSameAsScalar(IndexRange{std::size_t{1}<<63, std::numeric_limits<std::size_t>::max()});
+}
+
+TEST(IntegralRangeBulk, Throw)
+{
+    std::vector<int> values(100);
+    std::vector<std::uint64_t> mask(1);
+    std::vector<int> output(10);
+
+    EXPECT_ANY_THROW(MaskInRange(IntRange{0, 10}, std::span<const int>{values}, mask));
+    EXPECT_ANY_THROW(ClampToRange(IntRange{0, 10}, std::span<const int>{values}, output));
+    EXPECT_ANY_THROW(ClampToRange(IntRange{3, 3, EmptyPolicy::Allow}, std::span<const int>{values}, values));
+    ASSERT_ANY_THROW(FindClosest(IntRange{0, 10}, std::span<const int>{values}, output));
+}
+
+}
@@ -1,25 +1,41 @@
 #pragma once
-//! [C++11 Compatible]
-#include "ies/StdUtil/RequireCpp11.hpp" // IWYU pragma: keep
 
-#include <list>
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+
+#include <algorithm>
 #include <map>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "ies/Common/IntegralRange.hxx"
 #include "ies/Common/RangeSide.hpp"
-#include "ies/StdUtil/IsIn.hxx"
-#include "ies/StdUtil/ReverseEqualRange.hxx"
 
 namespace ies
 {
 
 //! @brief A list of non-overlapping IntegralRanges that can check if adding range overlap existing and space remain.
 //! e.g. [2, 5)--[7, 10), HasSpace([5, 7)), AddRange([2, 3)) fails.
+//! @note Ranges are stored in a flat vector sorted by begin (ends are sorted too since ranges do not overlap),
+//! so queries are one binary search without allocation. Adding range in middle moves later ranges,
+//! build from sorted ranges by constructor when adding many ranges at once.
 template <typename IntType>
 class IntegralRangeList
 {
 public:
+    //! @brief Index of FindRangeIndex(es) when no range contains value.
+    static constexpr std::size_t NoRangeIndex = static_cast<std::size_t>(-1);
+
+        IntegralRangeList() = default;
+
+    //! @brief Build list from [sortedRanges] sorted by begin without overlapping, e.g. address map loaded from file.
+    //! @throw std::runtime_error if ranges are not sorted or overlap.
+        explicit IntegralRangeList(std::vector<IntegralRange<IntType>> sortedRanges);
+
     //! @brief Add range to list if HasSpace, otherwise ignore the range.
         void
         AddRange(const IntegralRange<IntType> &range);
@@ -39,8 +55,22 @@ public:
         GetRange(IntType value)
         const;
 
-    //! @brief Get all ranges currently in list (dynamic generated.).
-        std::list<IntegralRange<IntType>>
+    //! @brief Find index of range containing value in GetRanges(), or NoRangeIndex.
+        std::size_t
+        FindRangeIndex(IntType value)
+        const;
+
+    //! @brief Batch of FindRangeIndex: indexes[i] is index of range containing values[i] in GetRanges(), or NoRangeIndex.
+    //! Sorted values are merged with ranges by galloping from previous result, so close values cost O(1) each.
+    //! Unsorted values are searched one by one, for large batches of unsorted values use IntegralRangeLookup.
+    //! @throw std::runtime_error if indexes is smaller than values.
+        void
+        FindRangeIndexes(std::span<const IntType> values, std::span<std::size_t> indexes)
+        const;
+
+    //! @brief Get all ranges currently in list, sorted by begin.
+    //! @note View is invalidated by AddRange.
+        std::span<const IntegralRange<IntType>>
         GetRanges()
         const;
 
@@ -65,18 +95,48 @@ public:
         const;
 
 private:
-    std::map<IntType, IntType> mBeginToEndMap;
+    using RangeIterator = typename std::vector<IntegralRange<IntType>>::const_iterator;
+
+    std::vector<IntegralRange<IntType>> mRanges;
+
+    //! @brief First range begins at or after value.
+        RangeIterator
+        LowerBoundBegin(IntType value)
+        const;
+
+    //! @brief Last range begins at or before value, or end() if none.
+        RangeIterator
+        FindLastBeginAtOrBefore(IntType value)
+        const;
 };
 
+template <typename IntType>
+IntegralRangeList<IntType>::
+IntegralRangeList(std::vector<IntegralRange<IntType>> sortedRanges)
+:   mRanges(std::move(sortedRanges))
+{
+    for (std::size_t i = 1; i<mRanges.size(); ++i)
+    {
+        if (mRanges[i].GetBegin()<mRanges[i-1].GetEnd())
+        {
+            throw std::runtime_error("IntegralRangeList: range "+ToString(mRanges[i])+" is not sorted after or overlaps "
+                                     +ToString(mRanges[i-1])+".");
+        }
+    }
+}
+
 template <typename IntType>
 void
 IntegralRangeList<IntType>::
 AddRange(const IntegralRange<IntType> &range)
 {
-    if (HasSpace(range))
+    //'' ranges before it begin before range end, so only the last of them can overlap.
+    auto it = LowerBoundBegin(range.GetEnd());
+    if (it!=mRanges.begin() && std::prev(it)->Overlaps(range))
     {
-        mBeginToEndMap[range.GetBegin()] = range.GetEnd();
+        return;
     }
+    mRanges.insert(it, range);
 }
 
 template <typename IntType>
@@ -85,7 +145,8 @@ IntegralRangeList<IntType>::
 HasSpace(const IntegralRange<IntType> &range)
 const
 {
-    return FindOverlappingRanges(range).GetRanges().empty();
+    auto it = LowerBoundBegin(range.GetEnd());
+    return it==mRanges.begin() || !std::prev(it)->Overlaps(range);
 }
 
 template <typename IntType>
@@ -94,13 +155,8 @@ IntegralRangeList<IntType>::
 HasRange(IntType value)
 const
 {
-    auto possibleBeginIt = mBeginToEndMap.upper_bound(value);
-    if (possibleBeginIt==mBeginToEndMap.begin())
-    {
-        return false;
-    }
-    --possibleBeginIt;
-    return IntegralRange<IntType>(possibleBeginIt->first, possibleBeginIt->second).IsInRange(value);
+    auto it = FindLastBeginAtOrBefore(value);
+    return it!=mRanges.end() && it->IsInRange(value);
 }
 
 template <typename IntType>
@@ -109,57 +165,97 @@ IntegralRangeList<IntType>::
 GetRange(IntType value)
 const
 {
-    if (!HasRange(value))
+    auto it = FindLastBeginAtOrBefore(value);
+    if (it==mRanges.end() || !it->IsInRange(value))
     {
         throw std::runtime_error("GetRange(): cannot get range of value.");
     }
-    auto it = ReverseLowerBound(mBeginToEndMap, value);
-    if (it==mBeginToEndMap.rend())
-    {
-        throw std::runtime_error("GetRange(): logic error.");
-    }
-    return IntegralRange<IntType>(it->first, it->second);
+    return *it;
 }
 
 template <typename IntType>
-std::list<IntegralRange<IntType>>
+std::size_t
 IntegralRangeList<IntType>::
-GetRanges()
+FindRangeIndex(IntType value)
 const
 {
-    std::list<IntegralRange<IntType>> ranges;
-    for (auto beginEnd : mBeginToEndMap)
+    auto it = FindLastBeginAtOrBefore(value);
+    if (it==mRanges.end() || !it->IsInRange(value))
     {
-        ranges.emplace_back(beginEnd.first, beginEnd.second);
+        return NoRangeIndex;
     }
-    return ranges;
+    return static_cast<std::size_t>(it-mRanges.begin());
 }
 
 template <typename IntType>
-IntegralRangeList<IntType>
+void
 IntegralRangeList<IntType>::
-FindOverlappingRanges(const IntegralRange<IntType> &range)
+FindRangeIndexes(std::span<const IntType> values, std::span<std::size_t> indexes)
 const
 {
-    IntegralRangeList<IntType> overlappingRanges;
+    if (indexes.size()<values.size())
+    {
+        throw std::runtime_error("IntegralRangeList::FindRangeIndexes: indexes size ["+std::to_string(indexes.size())
+                                 +"] is smaller than values size ["+std::to_string(values.size())+"].");
+    }
+    if (!std::is_sorted(values.begin(), values.end()))
+    {
+        for (std::size_t i = 0; i<values.size(); ++i)
+        {
+            indexes[i] = FindRangeIndex(values[i]);
+        }
+        return;
+    }
 
-    auto possibleBeginIt = mBeginToEndMap.upper_bound(range.GetBegin());
-    if (possibleBeginIt!=mBeginToEndMap.begin())
+    //'' [first, end) are ranges begin after previous value, find first one begins after value by galloping.
+    auto first = mRanges.begin();
+    for (std::size_t i = 0; i<values.size(); ++i)
     {
-        --possibleBeginIt;
+        auto value = values[i];
+        auto isBeginAtOrBefore = [value](const IntegralRange<IntType> &r) { return r.GetBegin()<=value; };
+        std::size_t step = 1;
+        auto last = first;
+        while (static_cast<std::size_t>(mRanges.end()-last)>step && isBeginAtOrBefore(last[static_cast<std::ptrdiff_t>(step)-1]))
+        {
+            last += static_cast<std::ptrdiff_t>(step);
+            step *= 2;
+        }
+        auto searchEnd = last+static_cast<std::ptrdiff_t>(std::min(step, static_cast<std::size_t>(mRanges.end()-last)));
+        first = std::partition_point(last, searchEnd, isBeginAtOrBefore);
+        indexes[i] = (first!=mRanges.begin() && std::prev(first)->IsInRange(value))
+                     ? static_cast<std::size_t>(first-mRanges.begin())-1
+                     : NoRangeIndex;
     }
+}
 
-    auto possibleEndIt = mBeginToEndMap.lower_bound(range.GetEnd());
+template <typename IntType>
+std::span<const IntegralRange<IntType>>
+IntegralRangeList<IntType>::
+GetRanges()
+const
+{
+    return mRanges;
+}
 
-    for (; possibleBeginIt!=possibleEndIt&&possibleBeginIt!=mBeginToEndMap.end(); ++possibleBeginIt)
+template <typename IntType>
+IntegralRangeList<IntType>
+IntegralRangeList<IntType>::
+FindOverlappingRanges(const IntegralRange<IntType> &range)
+const
+{
+    auto firstIt = std::partition_point(mRanges.begin(), mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetEnd()<=range.GetBegin(); });
+    auto lastIt = LowerBoundBegin(range.GetEnd());
+
+    IntegralRangeList<IntType> overlappingRanges;
+    for (auto it = firstIt; it<lastIt; ++it)
     {
-        const IntegralRange<IntType> comparingRange{possibleBeginIt->first, possibleBeginIt->second};
-        if (range.Overlaps(comparingRange))
+        //'' only differs at empty ranges, which have no overlap even when inside of other range.
+        if (range.Overlaps(*it))
         {
-            overlappingRanges.AddRange(comparingRange);
+            overlappingRanges.mRanges.push_back(*it);
         }
     }
-
     return overlappingRanges;
 }
 
@@ -171,30 +267,54 @@ const
 {
     std::map<RangeSide, IntegralRange<IntType>> adjacentRanges;
 
-    if (!IsIn(mBeginToEndMap, rangeBegin))
+    auto currentIt = LowerBoundBegin(rangeBegin);
+    if (currentIt==mRanges.end() || currentIt->GetBegin()!=rangeBegin)
     {
         throw std::runtime_error("no range begins with ["+std::to_string(rangeBegin)+"].");
     }
 
-    const IntegralRange<IntType> currentRange{rangeBegin, mBeginToEndMap.at(rangeBegin)};
-    auto currentIt = mBeginToEndMap.find(rangeBegin);
-    if (currentIt!=mBeginToEndMap.begin())
+    if (currentIt!=mRanges.begin())
     {
         auto prev = std::prev(currentIt);
-        if (prev->second==currentRange.GetBegin())
+        if (prev->GetEnd()==currentIt->GetBegin())
         {
-            adjacentRanges.emplace(RangeSide::Begin, IntegralRange<IntType>{prev->first, prev->second});
+            adjacentRanges.emplace(RangeSide::Begin, *prev);
         }
     }
     auto next = std::next(currentIt);
-    if (next!=mBeginToEndMap.end())
+    if (next!=mRanges.end())
     {
-        if (next->first==currentRange.GetEnd())
+        if (next->GetBegin()==currentIt->GetEnd())
         {
-            adjacentRanges.emplace(RangeSide::End, IntegralRange<IntType>{next->first, next->second});
+            adjacentRanges.emplace(RangeSide::End, *next);
         }
     }
     return adjacentRanges;
 }
 
+template <typename IntType>
+typename IntegralRangeList<IntType>::RangeIterator
+IntegralRangeList<IntType>::
+LowerBoundBegin(IntType value)
+const
+{
+    return std::partition_point(mRanges.begin(), mRanges.end(),
+        [value](const IntegralRange<IntType> &r) { return r.GetBegin()<value; });
+}
+
+template <typename IntType>
+typename IntegralRangeList<IntType>::RangeIterator
+IntegralRangeList<IntType>::
+FindLastBeginAtOrBefore(IntType value)
+const
+{
+    auto it = std::partition_point(mRanges.begin(), mRanges.end(),
+        [value](const IntegralRange<IntType> &r) { return r.GetBegin()<=value; });
+    if (it==mRanges.begin())
+    {
+        return mRanges.end();
+    }
+    return std::prev(it);
+}
+
 }
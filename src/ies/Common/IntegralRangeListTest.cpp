@@ -1,5 +1,8 @@
 #include "ies/Common/IntegralRangeList.hxx"
 
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace ies
@@ -78,9 +81,68 @@ TEST(IntegralRangeList, GetRanges)
     list.AddRange(IntRange(0, 3));
     list.AddRange(IntRange(6, 7));
 
-    std::list<IntRange> expectedList{{0, 3}, {6, 7}};
+    std::vector<IntRange> expectedList{{0, 3}, {6, 7}};
+    auto ranges = list.GetRanges();
+
+    ASSERT_EQ(expectedList, std::vector<IntRange>(ranges.begin(), ranges.end()));
+}
+
+TEST(IntegralRangeList, AddRangeKeepsSorted)
+{
+    IntegralRangeList<int> list;
+
+    list.AddRange(IntRange(10, 12));
+    list.AddRange(IntRange(0, 3));
+    list.AddRange(IntRange(5, 7));
+    list.AddRange(IntRange(2, 6));
+    list.AddRange(IntRange(3, 5));
+
+    std::vector<IntRange> expectedList{{0, 3}, {3, 5}, {5, 7}, {10, 12}};
+    auto ranges = list.GetRanges();
+
+    EXPECT_FALSE(list.HasSpace(IntRange(6, 11)));
+    EXPECT_TRUE(list.HasSpace(IntRange(7, 10)));
+    ASSERT_EQ(expectedList, std::vector<IntRange>(ranges.begin(), ranges.end()));
+}
+
+TEST(IntegralRangeList, ConstructFromSortedRanges)
+{
+    IntegralRangeList<int> list{{{0, 3}, {3, 5}, {8, 9}}};
+
+    EXPECT_EQ(3u, list.GetRanges().size());
+    EXPECT_EQ(IntRange(3, 5), list.GetRange(4));
+    EXPECT_FALSE(list.HasRange(5));
+    EXPECT_ANY_THROW(list.GetRange(7));
+
+    EXPECT_ANY_THROW(
+        IntegralRangeList<int>({{3, 5}, {0, 3}});
+    );
+    ASSERT_ANY_THROW(
+        IntegralRangeList<int>({{0, 4}, {3, 5}});
+    );
+}
+
+TEST(IntegralRangeList, FindRangeIndexes)
+{
+    IntegralRangeList<int> list{{{0, 3}, {5, 7}, {7, 9}, {20, 30}}};
+
+    EXPECT_EQ(1u, list.FindRangeIndex(6));
+    EXPECT_EQ(list.NoRangeIndex, list.FindRangeIndex(4));
+
+    std::vector<int> sortedValues{-1, 0, 2, 3, 5, 7, 8, 9, 19, 20, 29, 30, 100};
+    std::vector<std::size_t> expected{list.NoRangeIndex, 0, 0, list.NoRangeIndex, 1, 2, 2, list.NoRangeIndex,
+                                      list.NoRangeIndex, 3, 3, list.NoRangeIndex, list.NoRangeIndex};
+    std::vector<std::size_t> indexes(sortedValues.size());
+    list.FindRangeIndexes(sortedValues, indexes);
+    EXPECT_EQ(expected, indexes);
+
+    std::reverse(sortedValues.begin(), sortedValues.end());
+    std::reverse(expected.begin(), expected.end());
+    list.FindRangeIndexes(sortedValues, indexes);
+    EXPECT_EQ(expected, indexes);
 
-    ASSERT_EQ(expectedList, list.GetRanges());
+    std::vector<std::size_t> smallIndexes(2);
+    ASSERT_ANY_THROW(list.FindRangeIndexes(sortedValues, smallIndexes));
 }
 
 TEST(IntegralRangeList, FindOverlappingRanges)
@@ -92,11 +154,12 @@ TEST(IntegralRangeList, FindOverlappingRanges)
     list.AddRange(IntRange(7, 9));
     list.AddRange(IntRange(10, 12));
 
-    std::list<IntRange> expectedList{{4, 5}, {7, 9}, {10, 12}};
+    std::vector<IntRange> expectedList{{4, 5}, {7, 9}, {10, 12}};
 
     auto overlappingList = list.FindOverlappingRanges({4, 11});
+    auto ranges = overlappingList.GetRanges();
 
-    ASSERT_EQ(expectedList, overlappingList.GetRanges());
+    ASSERT_EQ(expectedList, std::vector<IntRange>(ranges.begin(), ranges.end()));
 }
 
 TEST(IntegralRangeList, FindAdjacentRanges)
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ies/Common/IntegralRange.hxx"
+#include "ies/Common/IntegralRangeList.hxx"
+#include "ies/Common/ParallelFor.hxx"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace ies { namespace Detail {
+
+//'' prefetch is only a hint, invalid address does not fault.
+inline
+void
+PrefetchRead(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+    (void)address;
+#endif
+}
+
+}}
+
+namespace ies
+{
+
+//! @brief Read-only snapshot of IntegralRangeList for stabbing queries of many unsorted values, e.g. address to region.
+//! Range begins are stored in Eytzinger (BFS) layout: the top levels of search share few cache lines,
+//! search is branchless except loop condition, and nodes 4 levels ahead are prefetched,
+//! so it is faster than binary search of sorted ranges once ranges do not fit in cache.
+//! @note Snapshot is not updated by later AddRange of list, construct new lookup after changing list.
+//! @example
+//!     IntegralRangeLookup<std::uint64_t> lookup{regions};
+//!     lookup.FindRangeIndexes(addresses, regionIndexes, 0);
+template <typename IntType>
+class IntegralRangeLookup
+{
+public:
+    static constexpr std::size_t NoRangeIndex = IntegralRangeList<IntType>::NoRangeIndex;
+
+        explicit IntegralRangeLookup(const IntegralRangeList<IntType> &list);
+
+    //! @brief Number of ranges.
+        std::size_t
+        size()
+        const;
+
+    //! @brief Find index of range containing value in list.GetRanges(), or NoRangeIndex.
+        std::size_t
+        FindRangeIndex(IntType value)
+        const;
+
+    //! @brief Batch of FindRangeIndex: indexes[i] is index of range containing values[i], or NoRangeIndex.
+    //! @note Values are split to at most [threadCount] chunks run by ParallelFor on ThreadPool::GetGlobal(),
+    //! 0 means std::thread::hardware_concurrency(). Small batches are not split.
+    //! @throw std::runtime_error if indexes is smaller than values.
+        void
+        FindRangeIndexes(std::span<const IntType> values, std::span<std::size_t> indexes, std::size_t threadCount=1)
+        const;
+
+private:
+    //'' batch smaller than this per chunk is not worth running on ThreadPool.
+    static constexpr std::size_t MinValuesPerThread = 16384;
+    //'' node k has children 2k and 2k+1, node k*PrefetchStride is 4 levels down and shares its cache line with siblings.
+    static constexpr std::size_t PrefetchStride = 16;
+
+    //'' 1-based Eytzinger layout of range begins, node 0 is unused.
+    std::vector<IntType> mBegins;
+    //'' index in sorted ranges of each Eytzinger node, node 0 is end (sorted size).
+    std::vector<std::size_t> mSortedIndexes;
+    std::vector<IntType> mEnds;
+
+        std::size_t
+        BuildLayout(std::span<const IntegralRange<IntType>> ranges, std::size_t sortedIndex, std::size_t node);
+
+        void
+        FindRangeIndexesInChunk(std::span<const IntType> values, std::span<std::size_t> indexes)
+        const;
+};
+
+template <typename IntType>
+IntegralRangeLookup<IntType>::
+IntegralRangeLookup(const IntegralRangeList<IntType> &list)
+{
+    auto ranges = list.GetRanges();
+    mBegins.resize(ranges.size()+1);
+    mSortedIndexes.resize(ranges.size()+1);
+    mSortedIndexes[0] = ranges.size();
+    mEnds.reserve(ranges.size());
+    for (const auto &range : ranges)
+    {
+        mEnds.push_back(range.GetEnd());
+    }
+    BuildLayout(ranges, 0, 1);
+}
+
+template <typename IntType>
+std::size_t
+IntegralRangeLookup<IntType>::
+size()
+const
+{
+    return mEnds.size();
+}
+
+template <typename IntType>
+std::size_t
+IntegralRangeLookup<IntType>::
+FindRangeIndex(IntType value)
+const
+{
+    const auto* begins = mBegins.data();
+    const auto count = mEnds.size();
+    std::size_t node = 1;
+    while (node<=count)
+    {
+        Detail::PrefetchRead(reinterpret_cast<const void*>(reinterpret_cast<std::uintptr_t>(begins)+node*PrefetchStride*sizeof(IntType)));
+        node = 2*node+static_cast<std::size_t>(begins[node]<=value);
+    }
+    //'' remove trailing right turns and last left turn: node of first begin greater than value (0 if none).
+    node >>= std::countr_one(node)+1;
+    auto upperIndex = mSortedIndexes[node];
+    if (upperIndex==0 || !(value<mEnds[upperIndex-1]))
+    {
+        return NoRangeIndex;
+    }
+    return upperIndex-1;
+}
+
+template <typename IntType>
+void
+IntegralRangeLookup<IntType>::
+FindRangeIndexes(std::span<const IntType> values, std::span<std::size_t> indexes, std::size_t threadCount)
+const
+{
+    if (indexes.size()<values.size())
+    {
+        throw std::runtime_error("IntegralRangeLookup::FindRangeIndexes: indexes size ["+std::to_string(indexes.size())
+                                 +"] is smaller than values size ["+std::to_string(values.size())+"].");
+    }
+    if (threadCount==0)
+    {
+        threadCount = std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, std::max(std::size_t{1}, values.size()/MinValuesPerThread));
+    if (threadCount==1)
+    {
+        FindRangeIndexesInChunk(values, indexes);
+        return;
+    }
+
+    auto chunkSize = (values.size()+threadCount-1)/threadCount;
+    auto chunkCount = (values.size()+chunkSize-1)/chunkSize;
+    ParallelFor(IndexRange{0, chunkCount}, [&](std::size_t chunk)
+    {
+        auto begin = chunk*chunkSize;
+        auto size = std::min(chunkSize, values.size()-begin);
+        FindRangeIndexesInChunk(values.subspan(begin, size), indexes.subspan(begin, size));
+    }, 1);
+}
+
+template <typename IntType>
+std::size_t
+IntegralRangeLookup<IntType>::
+BuildLayout(std::span<const IntegralRange<IntType>> ranges, std::size_t sortedIndex, std::size_t node)
+{
+    //'' in-order traversal of implicit tree visits nodes in sorted order.
+    if (node<=ranges.size())
+    {
+        sortedIndex = BuildLayout(ranges, sortedIndex, 2*node);
+        mBegins[node] = ranges[sortedIndex].GetBegin();
+        mSortedIndexes[node] = sortedIndex;
+        sortedIndex = BuildLayout(ranges, sortedIndex+1, 2*node+1);
+    }
+    return sortedIndex;
+}
+
+template <typename IntType>
+void
+IntegralRangeLookup<IntType>::
+FindRangeIndexesInChunk(std::span<const IntType> values, std::span<std::size_t> indexes)
+const
+{
+    for (std::size_t i = 0; i<values.size(); ++i)
+    {
+        indexes[i] = FindRangeIndex(values[i]);
+    }
+}
+
+}
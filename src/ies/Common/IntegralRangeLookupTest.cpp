@@ -0,0 +1,104 @@
+#include "ies/Common/IntegralRangeLookup.hxx"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+namespace
+{
+
+//'' ranges with random sizes and gaps, some adjacent.
+IntegralRangeList<unsigned int>
+MakeRandomRangeList(std::size_t count, std::mt19937 &generator)
+{
+    std::uniform_int_distribution<unsigned int> distribution{0, 4};
+    std::vector<UIntRange> ranges;
+    unsigned int begin = 0;
+    for (std::size_t i = 0; i<count; ++i)
+    {
+        begin += distribution(generator);
+        auto end = begin+1+distribution(generator);
+        ranges.emplace_back(begin, end);
+        begin = end;
+    }
+    return IntegralRangeList<unsigned int>{ranges};
+}
+
+}
+
+TEST(IntegralRangeLookup, Empty)
+{
+    IntegralRangeLookup<int> lookup{IntegralRangeList<int>{}};
+
+    EXPECT_EQ(0u, lookup.size());
+    ASSERT_EQ(lookup.NoRangeIndex, lookup.FindRangeIndex(0));
+}
+
+TEST(IntegralRangeLookup, FindRangeIndex)
+{
+    IntegralRangeList<int> list{{{-10, -5}, {0, 3}, {5, 7}, {7, 9}, {20, 30}}};
+    IntegralRangeLookup<int> lookup{list};
+
+    EXPECT_EQ(5u, lookup.size());
+    EXPECT_EQ(lookup.NoRangeIndex, lookup.FindRangeIndex(-11));
+    EXPECT_EQ(0u, lookup.FindRangeIndex(-10));
+    EXPECT_EQ(lookup.NoRangeIndex, lookup.FindRangeIndex(-5));
+    EXPECT_EQ(1u, lookup.FindRangeIndex(2));
+    EXPECT_EQ(2u, lookup.FindRangeIndex(6));
+    EXPECT_EQ(3u, lookup.FindRangeIndex(7));
+    EXPECT_EQ(4u, lookup.FindRangeIndex(29));
+    ASSERT_EQ(lookup.NoRangeIndex, lookup.FindRangeIndex(30));
+}
+
+TEST(IntegralRangeLookup, SameAsRangeList)
+{
+    std::mt19937 generator{11};
+    for (std::size_t count : {1u, 2u, 3u, 7u, 8u, 100u, 1000u})
+    {
+        auto list = MakeRandomRangeList(count, generator);
+        IntegralRangeLookup<unsigned int> lookup{list};
+        auto maxValue = list.GetRanges().back().GetEnd()+2;
+        for (unsigned int value = 0; value<maxValue; ++value)
+        {
+            ASSERT_EQ(list.FindRangeIndex(value), lookup.FindRangeIndex(value));
+        }
+    }
+}
+
+TEST(IntegralRangeLookup, FindRangeIndexes)
+{
+    std::mt19937 generator{13};
+    auto list = MakeRandomRangeList(5000, generator);
+    IntegralRangeLookup<unsigned int> lookup{list};
+
+    std::uniform_int_distribution<unsigned int> distribution{0, list.GetRanges().back().GetEnd()};
+    std::vector<unsigned int> values(100000);
+    for (auto &value : values)
+    {
+        value = distribution(generator);
+    }
+    std::vector<std::size_t> expected(values.size());
+    list.FindRangeIndexes(values, expected);
+
+    std::vector<std::size_t> indexes(values.size());
+    lookup.FindRangeIndexes(values, indexes);
+    EXPECT_EQ(expected, indexes);
+
+    std::vector<std::size_t> threadIndexes(values.size());
+    lookup.FindRangeIndexes(values, threadIndexes, 4);
+    EXPECT_EQ(expected, threadIndexes);
+
+    std::sort(values.begin(), values.end());
+    list.FindRangeIndexes(values, expected);
+    lookup.FindRangeIndexes(values, indexes);
+    EXPECT_EQ(expected, indexes);
+
+    std::vector<std::size_t> smallIndexes(2);
+    ASSERT_ANY_THROW(lookup.FindRangeIndexes(values, smallIndexes));
+}
+
+}
@@ -0,0 +1,473 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ies/Common/IntegralRange.hxx"
+
+namespace ies
+{
+
+//! @brief Set of integral values stored as coalesced IntegralRanges, e.g. used space of allocator or file extents.
+//! Unlike IntegralRangeList which rejects overlapping range, InsertRange merges overlapping and adjacent ranges,
+//! and RemoveRange splits ranges, so ranges in set are always sorted, non-empty and separated by gaps.
+//! @example
+//!     IntegralRangeSet<int> used;
+//!     used.InsertRange({0, 4});
+//!     used.InsertRange({4, 8});   //'' [0, 8)
+//!     used.RemoveRange({2, 3});   //'' [0, 2)-[3, 8)
+//!     auto free = used.FindFirstFit(4, {0, 100}); //'' [8, 12)
+template <typename IntType>
+class IntegralRangeSet
+{
+public:
+        IntegralRangeSet() = default;
+
+    //! @brief Build set from [ranges] in any order, overlapping and adjacent ranges are merged, empty ranges are ignored.
+        explicit IntegralRangeSet(std::vector<IntegralRange<IntType>> ranges);
+
+    //! @brief Add all values of range to set, merging with overlapping and adjacent ranges.
+        void
+        InsertRange(const IntegralRange<IntType> &range);
+
+    //! @brief Remove all values of range from set, ranges partially covered are cut or split in two.
+        void
+        RemoveRange(const IntegralRange<IntType> &range);
+
+    //! @brief Check if value is in set.
+        bool
+        HasRange(IntType value)
+        const;
+
+    //! @brief Get range of set containing value.
+    //! @throw std::runtime_error if value is not in set.
+        IntegralRange<IntType>
+        GetRange(IntType value)
+        const;
+
+    //! @brief Check if all values of range are in set.
+        bool
+        Contains(const IntegralRange<IntType> &range)
+        const;
+
+    //! @brief Check if any value of range is in set.
+        bool
+        Overlaps(const IntegralRange<IntType> &range)
+        const;
+
+    //! @brief Get all ranges in set, sorted by begin.
+    //! @note View is invalidated by InsertRange and RemoveRange.
+        std::span<const IntegralRange<IntType>>
+        GetRanges()
+        const;
+
+    //! @brief Get gaps between ranges of set inside [bounds], i.e. values of bounds not in set.
+        IntegralRangeSet<IntType>
+        GetGaps(const IntegralRange<IntType> &bounds)
+        const;
+
+    //! @brief Find first (lowest) gap inside [bounds] with at least [size] values, return [gapBegin, gapBegin+size).
+    //! Return std::nullopt if no gap is large enough.
+        std::optional<IntegralRange<IntType>>
+        FindFirstFit(IntType size, const IntegralRange<IntType> &bounds)
+        const;
+
+    //! @brief Find smallest gap inside [bounds] with at least [size] values (first one if tied),
+    //! return [gapBegin, gapBegin+size). Return std::nullopt if no gap is large enough.
+        std::optional<IntegralRange<IntType>>
+        FindBestFit(IntType size, const IntegralRange<IntType> &bounds)
+        const;
+
+private:
+    using ConstRangeIterator = typename std::vector<IntegralRange<IntType>>::const_iterator;
+
+    std::vector<IntegralRange<IntType>> mRanges;
+
+    //! @brief Last range begins at or before value, or end() if none.
+        ConstRangeIterator
+        FindLastBeginAtOrBefore(IntType value)
+        const;
+
+    //! @brief Call visit(gap) for each gap inside [bounds] in order, stop when visit returns true.
+        template <typename Visit>
+        void
+        VisitGaps(const IntegralRange<IntType> &bounds, Visit visit)
+        const;
+
+    //! @brief Append range after all ranges of set, merging with last range if overlapping or adjacent.
+        void
+        AppendRange(const IntegralRange<IntType> &range);
+
+    template <typename T>
+    friend IntegralRangeSet<T> Union(const IntegralRangeSet<T> &, const IntegralRangeSet<T> &);
+    template <typename T>
+    friend IntegralRangeSet<T> Intersection(const IntegralRangeSet<T> &, const IntegralRangeSet<T> &);
+    template <typename T>
+    friend IntegralRangeSet<T> Difference(const IntegralRangeSet<T> &, const IntegralRangeSet<T> &);
+};
+
+template <typename IntType>
+IntegralRangeSet<IntType>::
+IntegralRangeSet(std::vector<IntegralRange<IntType>> ranges)
+{
+    auto isBeginLess = [](const IntegralRange<IntType> &lhs, const IntegralRange<IntType> &rhs)
+    {
+        return lhs.GetBegin()<rhs.GetBegin();
+    };
+    if (!std::is_sorted(ranges.begin(), ranges.end(), isBeginLess))
+    {
+        std::sort(ranges.begin(), ranges.end(), isBeginLess);
+    }
+    mRanges.reserve(ranges.size());
+    for (const auto &range : ranges)
+    {
+        AppendRange(range);
+    }
+}
+
+template <typename IntType>
+void
+IntegralRangeSet<IntType>::
+InsertRange(const IntegralRange<IntType> &range)
+{
+    if (range.empty())
+    {
+        return;
+    }
+    //'' [first, last) are ranges overlapping or adjacent to range.
+    auto first = std::partition_point(mRanges.begin(), mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetEnd()<range.GetBegin(); });
+    auto last = std::partition_point(first, mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetBegin()<=range.GetEnd(); });
+    if (first==last)
+    {
+        mRanges.insert(first, range);
+        return;
+    }
+    *first = IntegralRange<IntType>{std::min(first->GetBegin(), range.GetBegin()),
+                                    std::max(std::prev(last)->GetEnd(), range.GetEnd())};
+    mRanges.erase(std::next(first), last);
+}
+
+template <typename IntType>
+void
+IntegralRangeSet<IntType>::
+RemoveRange(const IntegralRange<IntType> &range)
+{
+    if (range.empty())
+    {
+        return;
+    }
+    //'' [first, last) are ranges overlapping range.
+    auto first = std::partition_point(mRanges.begin(), mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetEnd()<=range.GetBegin(); });
+    auto last = std::partition_point(first, mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetBegin()<range.GetEnd(); });
+    if (first==last)
+    {
+        return;
+    }
+    auto leftBegin = first->GetBegin();
+    auto rightEnd = std::prev(last)->GetEnd();
+
+    //'' reuse slots of removed ranges for remaining pieces, only splitting one range needs insert.
+    auto it = first;
+    if (leftBegin<range.GetBegin())
+    {
+        *it++ = IntegralRange<IntType>{leftBegin, range.GetBegin()};
+    }
+    if (range.GetEnd()<rightEnd)
+    {
+        if (it==last)
+        {
+            mRanges.emplace(last, range.GetEnd(), rightEnd);
+            return;
+        }
+        *it++ = IntegralRange<IntType>{range.GetEnd(), rightEnd};
+    }
+    mRanges.erase(it, last);
+}
+
+template <typename IntType>
+bool
+IntegralRangeSet<IntType>::
+HasRange(IntType value)
+const
+{
+    auto it = FindLastBeginAtOrBefore(value);
+    return it!=mRanges.end() && it->IsInRange(value);
+}
+
+template <typename IntType>
+IntegralRange<IntType>
+IntegralRangeSet<IntType>::
+GetRange(IntType value)
+const
+{
+    auto it = FindLastBeginAtOrBefore(value);
+    if (it==mRanges.end() || !it->IsInRange(value))
+    {
+        throw std::runtime_error("IntegralRangeSet::GetRange(): value ["+std::to_string(value)+"] is not in set.");
+    }
+    return *it;
+}
+
+template <typename IntType>
+bool
+IntegralRangeSet<IntType>::
+Contains(const IntegralRange<IntType> &range)
+const
+{
+    if (range.empty())
+    {
+        return true;
+    }
+    auto it = FindLastBeginAtOrBefore(range.GetBegin());
+    return it!=mRanges.end() && it->Contains(range);
+}
+
+template <typename IntType>
+bool
+IntegralRangeSet<IntType>::
+Overlaps(const IntegralRange<IntType> &range)
+const
+{
+    if (range.empty())
+    {
+        return false;
+    }
+    auto it = std::partition_point(mRanges.begin(), mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetEnd()<=range.GetBegin(); });
+    return it!=mRanges.end() && it->GetBegin()<range.GetEnd();
+}
+
+template <typename IntType>
+std::span<const IntegralRange<IntType>>
+IntegralRangeSet<IntType>::
+GetRanges()
+const
+{
+    return mRanges;
+}
+
+template <typename IntType>
+IntegralRangeSet<IntType>
+IntegralRangeSet<IntType>::
+GetGaps(const IntegralRange<IntType> &bounds)
+const
+{
+    IntegralRangeSet<IntType> gaps;
+    VisitGaps(bounds, [&](const IntegralRange<IntType> &gap)
+    {
+        gaps.mRanges.push_back(gap);
+        return false;
+    });
+    return gaps;
+}
+
+template <typename IntType>
+std::optional<IntegralRange<IntType>>
+IntegralRangeSet<IntType>::
+FindFirstFit(IntType size, const IntegralRange<IntType> &bounds)
+const
+{
+    std::optional<IntegralRange<IntType>> fit;
+    VisitGaps(bounds, [&](const IntegralRange<IntType> &gap)
+    {
+        if (static_cast<IntType>(gap.GetEnd()-gap.GetBegin())>=size)
+        {
+            fit.emplace(gap.GetBegin(), static_cast<IntType>(gap.GetBegin()+size), EmptyPolicy::Allow);
+            return true;
+        }
+        return false;
+    });
+    return fit;
+}
+
+template <typename IntType>
+std::optional<IntegralRange<IntType>>
+IntegralRangeSet<IntType>::
+FindBestFit(IntType size, const IntegralRange<IntType> &bounds)
+const
+{
+    std::optional<IntegralRange<IntType>> bestGap;
+    VisitGaps(bounds, [&](const IntegralRange<IntType> &gap)
+    {
+        auto gapSize = static_cast<IntType>(gap.GetEnd()-gap.GetBegin());
+        if (gapSize>=size && (!bestGap || gapSize<static_cast<IntType>(bestGap->GetEnd()-bestGap->GetBegin())))
+        {
+            bestGap = gap;
+        }
+        //'' exact fit cannot be beaten.
+        return bestGap && gapSize==size;
+    });
+    if (!bestGap)
+    {
+        return std::nullopt;
+    }
+    return IntegralRange<IntType>{bestGap->GetBegin(), static_cast<IntType>(bestGap->GetBegin()+size), EmptyPolicy::Allow};
+}
+
+template <typename IntType>
+typename IntegralRangeSet<IntType>::ConstRangeIterator
+IntegralRangeSet<IntType>::
+FindLastBeginAtOrBefore(IntType value)
+const
+{
+    auto it = std::partition_point(mRanges.begin(), mRanges.end(),
+        [value](const IntegralRange<IntType> &r) { return r.GetBegin()<=value; });
+    if (it==mRanges.begin())
+    {
+        return mRanges.end();
+    }
+    return std::prev(it);
+}
+
+template <typename IntType>
+template <typename Visit>
+void
+IntegralRangeSet<IntType>::
+VisitGaps(const IntegralRange<IntType> &bounds, Visit visit)
+const
+{
+    auto cursor = bounds.GetBegin();
+    auto it = std::partition_point(mRanges.begin(), mRanges.end(),
+        [&](const IntegralRange<IntType> &r) { return r.GetEnd()<=bounds.GetBegin(); });
+    for (; it!=mRanges.end() && it->GetBegin()<bounds.GetEnd(); ++it)
+    {
+        if (cursor<it->GetBegin() && visit(IntegralRange<IntType>{cursor, it->GetBegin()}))
+        {
+            return;
+        }
+        cursor = it->GetEnd();
+    }
+    if (cursor<bounds.GetEnd())
+    {
+        visit(IntegralRange<IntType>{cursor, bounds.GetEnd()});
+    }
+}
+
+template <typename IntType>
+void
+IntegralRangeSet<IntType>::
+AppendRange(const IntegralRange<IntType> &range)
+{
+    if (range.empty())
+    {
+        return;
+    }
+    if (!mRanges.empty() && range.GetBegin()<=mRanges.back().GetEnd())
+    {
+        if (mRanges.back().GetEnd()<range.GetEnd())
+        {
+            mRanges.back() = IntegralRange<IntType>{mRanges.back().GetBegin(), range.GetEnd()};
+        }
+        return;
+    }
+    mRanges.push_back(range);
+}
+
+template <typename IntType>
+bool
+operator==(const IntegralRangeSet<IntType> &lhs, const IntegralRangeSet<IntType> &rhs)
+{
+    return std::equal(lhs.GetRanges().begin(), lhs.GetRanges().end(), rhs.GetRanges().begin(), rhs.GetRanges().end());
+}
+
+//! @brief Values in lhs or rhs, merged in linear time.
+template <typename IntType>
+IntegralRangeSet<IntType>
+Union(const IntegralRangeSet<IntType> &lhs, const IntegralRangeSet<IntType> &rhs)
+{
+    IntegralRangeSet<IntType> result;
+    result.mRanges.reserve(lhs.mRanges.size()+rhs.mRanges.size());
+    auto lhsIt = lhs.mRanges.begin();
+    auto rhsIt = rhs.mRanges.begin();
+    while (lhsIt!=lhs.mRanges.end() || rhsIt!=rhs.mRanges.end())
+    {
+        if (rhsIt==rhs.mRanges.end() || (lhsIt!=lhs.mRanges.end() && lhsIt->GetBegin()<rhsIt->GetBegin()))
+        {
+            result.AppendRange(*lhsIt++);
+        }
+        else
+        {
+            result.AppendRange(*rhsIt++);
+        }
+    }
+    return result;
+}
+
+//! @brief Values in both lhs and rhs, in linear time.
+template <typename IntType>
+IntegralRangeSet<IntType>
+Intersection(const IntegralRangeSet<IntType> &lhs, const IntegralRangeSet<IntType> &rhs)
+{
+    IntegralRangeSet<IntType> result;
+    auto lhsIt = lhs.mRanges.begin();
+    auto rhsIt = rhs.mRanges.begin();
+    while (lhsIt!=lhs.mRanges.end() && rhsIt!=rhs.mRanges.end())
+    {
+        auto begin = std::max(lhsIt->GetBegin(), rhsIt->GetBegin());
+        auto end = std::min(lhsIt->GetEnd(), rhsIt->GetEnd());
+        if (begin<end)
+        {
+            result.mRanges.emplace_back(begin, end);
+        }
+        //'' range ending first cannot overlap any later range of other set.
+        if (lhsIt->GetEnd()<rhsIt->GetEnd())
+        {
+            ++lhsIt;
+        }
+        else
+        {
+            ++rhsIt;
+        }
+    }
+    return result;
+}
+
+//! @brief Values in lhs but not in rhs, in linear time.
+template <typename IntType>
+IntegralRangeSet<IntType>
+Difference(const IntegralRangeSet<IntType> &lhs, const IntegralRangeSet<IntType> &rhs)
+{
+    IntegralRangeSet<IntType> result;
+    auto rhsIt = rhs.mRanges.begin();
+    for (const auto &range : lhs.mRanges)
+    {
+        auto cursor = range.GetBegin();
+        while (rhsIt!=rhs.mRanges.end() && rhsIt->GetEnd()<=cursor)
+        {
+            ++rhsIt;
+        }
+        //'' rhs ranges inside this range cut it into pieces, last one may continue into next range.
+        for (auto it = rhsIt; it!=rhs.mRanges.end() && it->GetBegin()<range.GetEnd(); ++it)
+        {
+            if (cursor<it->GetBegin())
+            {
+                result.mRanges.emplace_back(cursor, it->GetBegin());
+            }
+            cursor = std::max(cursor, it->GetEnd());
+            if (range.GetEnd()<=cursor)
+            {
+                break;
+            }
+        }
+        if (cursor<range.GetEnd())
+        {
+            result.mRanges.emplace_back(cursor, range.GetEnd());
+        }
+    }
+    return result;
+}
+
+}
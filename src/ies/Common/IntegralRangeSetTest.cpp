@@ -0,0 +1,198 @@
+#include "ies/Common/IntegralRangeSet.hxx"
+
+#include <bitset>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+namespace
+{
+
+constexpr int MaxValue = 64;
+
+std::vector<IntRange>
+ToVector(const IntegralRangeSet<int> &set)
+{
+    return {set.GetRanges().begin(), set.GetRanges().end()};
+}
+
+std::bitset<MaxValue>
+ToBitset(const IntegralRangeSet<int> &set)
+{
+    std::bitset<MaxValue> bits;
+    for (const auto &range : set.GetRanges())
+    {
+        for (auto i : range)
+        {
+            bits.set(static_cast<std::size_t>(i));
+        }
+    }
+    return bits;
+}
+
+//'' bitset of set is not enough, ranges also need to be coalesced.
+IntegralRangeSet<int>
+FromBitset(const std::bitset<MaxValue> &bits)
+{
+    std::vector<IntRange> ranges;
+    for (int i = 0; i<MaxValue; ++i)
+    {
+        if (bits.test(static_cast<std::size_t>(i)))
+        {
+            ranges.emplace_back(i, i+1);
+        }
+    }
+    return IntegralRangeSet<int>{ranges};
+}
+
+IntRange
+MakeRandomRange(std::mt19937 &generator)
+{
+    std::uniform_int_distribution<int> distribution{0, MaxValue-1};
+    auto begin = distribution(generator);
+    auto end = distribution(generator);
+    if (end<begin)
+    {
+        std::swap(begin, end);
+    }
+    return {begin, end+1};
+}
+
+}
+
+TEST(IntegralRangeSet, InsertRangeMerges)
+{
+    IntegralRangeSet<int> set;
+
+    set.InsertRange(IntRange(10, 12));
+    set.InsertRange(IntRange(0, 3));
+    set.InsertRange(IntRange(5, 7));
+    EXPECT_EQ((std::vector<IntRange>{{0, 3}, {5, 7}, {10, 12}}), ToVector(set));
+
+    set.InsertRange(IntRange(3, 4));
+    EXPECT_EQ((std::vector<IntRange>{{0, 4}, {5, 7}, {10, 12}}), ToVector(set));
+
+    set.InsertRange(IntRange(6, 10));
+    EXPECT_EQ((std::vector<IntRange>{{0, 4}, {5, 12}}), ToVector(set));
+
+    set.InsertRange(IntRange(6, 6, EmptyPolicy::Allow));
+    set.InsertRange(IntRange(1, 2));
+    EXPECT_EQ((std::vector<IntRange>{{0, 4}, {5, 12}}), ToVector(set));
+
+    set.InsertRange(IntRange(-5, 20));
+    ASSERT_EQ((std::vector<IntRange>{{-5, 20}}), ToVector(set));
+}
+
+TEST(IntegralRangeSet, RemoveRangeSplits)
+{
+    IntegralRangeSet<int> set{{{0, 10}, {20, 30}}};
+
+    set.RemoveRange(IntRange(3, 5));
+    EXPECT_EQ((std::vector<IntRange>{{0, 3}, {5, 10}, {20, 30}}), ToVector(set));
+
+    set.RemoveRange(IntRange(8, 25));
+    EXPECT_EQ((std::vector<IntRange>{{0, 3}, {5, 8}, {25, 30}}), ToVector(set));
+
+    set.RemoveRange(IntRange(10, 20));
+    set.RemoveRange(IntRange(0, 3));
+    EXPECT_EQ((std::vector<IntRange>{{5, 8}, {25, 30}}), ToVector(set));
+
+    set.RemoveRange(IntRange(0, 100));
+    ASSERT_TRUE(set.GetRanges().empty());
+}
+
+TEST(IntegralRangeSet, ConstructFromUnsortedRanges)
+{
+    IntegralRangeSet<int> set{{{8, 9}, {0, 3}, {2, 5}, {5, 6}, {7, 7, EmptyPolicy::Allow}}};
+
+    ASSERT_EQ((std::vector<IntRange>{{0, 6}, {8, 9}}), ToVector(set));
+}
+
+TEST(IntegralRangeSet, Query)
+{
+    IntegralRangeSet<unsigned int> set{{{0, 3}, {5, 8}}};
+
+    EXPECT_TRUE(set.HasRange(0));
+    EXPECT_FALSE(set.HasRange(3));
+    EXPECT_EQ(UIntRange(5, 8), set.GetRange(7));
+    EXPECT_ANY_THROW(set.GetRange(4));
+
+    EXPECT_TRUE(set.Contains(UIntRange(5, 8)));
+    EXPECT_FALSE(set.Contains(UIntRange(2, 6)));
+    EXPECT_TRUE(set.Overlaps(UIntRange(2, 6)));
+    EXPECT_FALSE(set.Overlaps(UIntRange(3, 5)));
+    ASSERT_FALSE(set.Overlaps(UIntRange(8, 100)));
+}
+
+TEST(IntegralRangeSet, Gaps)
+{
+    IntegralRangeSet<int> used{{{2, 4}, {6, 7}, {10, 20}}};
+
+    EXPECT_EQ((std::vector<IntRange>{{0, 2}, {4, 6}, {7, 10}, {20, 25}}), ToVector(used.GetGaps({0, 25})));
+    EXPECT_EQ((std::vector<IntRange>{{4, 6}, {7, 8}}), ToVector(used.GetGaps({3, 8})));
+
+    EXPECT_EQ(IntRange(0, 2), used.FindFirstFit(2, {0, 25}));
+    EXPECT_EQ(IntRange(7, 10), used.FindFirstFit(3, {0, 25}));
+    EXPECT_EQ(IntRange(20, 24), used.FindFirstFit(4, {0, 25}));
+    EXPECT_FALSE(used.FindFirstFit(6, {0, 25}).has_value());
+
+    EXPECT_EQ(IntRange(1, 2), used.FindBestFit(1, {1, 25}));
+    EXPECT_EQ(IntRange(4, 6), used.FindBestFit(2, {1, 25}));
+    EXPECT_EQ(IntRange(0, 2), used.FindBestFit(2, {0, 25}));
+    EXPECT_EQ(IntRange(7, 10), used.FindBestFit(3, {0, 25}));
+    ASSERT_FALSE(used.FindBestFit(6, {0, 25}).has_value());
+}
+
+TEST(IntegralRangeSet, SetAlgebra)
+{
+    IntegralRangeSet<int> lhs{{{0, 5}, {10, 15}, {20, 25}}};
+    IntegralRangeSet<int> rhs{{{3, 12}, {14, 16}, {30, 31}}};
+
+    EXPECT_EQ((std::vector<IntRange>{{0, 16}, {20, 25}, {30, 31}}), ToVector(Union(lhs, rhs)));
+    EXPECT_EQ((std::vector<IntRange>{{3, 5}, {10, 12}, {14, 15}}), ToVector(Intersection(lhs, rhs)));
+    EXPECT_EQ((std::vector<IntRange>{{0, 3}, {12, 14}, {20, 25}}), ToVector(Difference(lhs, rhs)));
+    ASSERT_EQ((std::vector<IntRange>{{5, 10}, {15, 16}, {30, 31}}), ToVector(Difference(rhs, lhs)));
+}
+
+TEST(IntegralRangeSet, SameAsBitset)
+{
+    std::mt19937 generator{7};
+    for (int round = 0; round<200; ++round)
+    {
+        IntegralRangeSet<int> lhs;
+        IntegralRangeSet<int> rhs;
+        std::bitset<MaxValue> lhsBits;
+        std::bitset<MaxValue> rhsBits;
+        for (int i = 0; i<8; ++i)
+        {
+            auto range = MakeRandomRange(generator);
+            auto* set = (i%2==0) ? &lhs : &rhs;
+            auto* bits = (i%2==0) ? &lhsBits : &rhsBits;
+            auto isInsert = (generator()%3!=0);
+            for (auto value : range)
+            {
+                bits->set(static_cast<std::size_t>(value), isInsert);
+            }
+            if (isInsert)
+            {
+                set->InsertRange(range);
+            }
+            else
+            {
+                set->RemoveRange(range);
+            }
+        }
+        ASSERT_EQ(FromBitset(lhsBits), lhs);
+        ASSERT_EQ(FromBitset(rhsBits), rhs);
+        ASSERT_EQ(FromBitset(lhsBits|rhsBits), Union(lhs, rhs));
+        ASSERT_EQ(FromBitset(lhsBits&rhsBits), Intersection(lhs, rhs));
+        ASSERT_EQ(FromBitset(lhsBits&~rhsBits), Difference(lhs, rhs));
+        ASSERT_EQ(ToBitset(lhs), lhsBits);
+    }
+}
+
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ies/Common/IntegralRange.hxx"
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace ies { namespace Detail {
+
+//! @brief Random access iterator of StridedIntegralRange, Step is +1 (Forward) or -1 (Reverse).
+//! Iterator is first value of range and index of step, value is first value advanced index*stride in iterating direction.
+//! Comparing and distance are by index, so they are exact even if values wrap near end of IntType.
+//! @note Same as IntegralRangeIterator, iterator_concept is random access and iterator_category is input.
+template <typename IntType, int Step>
+class StridedIntegralRangeIterator
+{
+public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type = IntType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = IntType;
+
+        StridedIntegralRangeIterator()
+        :   mFirst(0), mIndex(0), mStride(1)
+        {}
+
+        StridedIntegralRangeIterator(IntType first, difference_type index, std::size_t stride)
+        :   mFirst(first), mIndex(index), mStride(stride)
+        {}
+
+        IntType
+        operator*()
+        const
+        {
+            return ValueAt(mIndex);
+        }
+
+        IntType
+        operator[](difference_type n)
+        const
+        {
+            return ValueAt(mIndex+n);
+        }
+
+        StridedIntegralRangeIterator &
+        operator++()
+        {
+            ++mIndex;
+            return *this;
+        }
+
+        StridedIntegralRangeIterator
+        operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        StridedIntegralRangeIterator &
+        operator--()
+        {
+            --mIndex;
+            return *this;
+        }
+
+        StridedIntegralRangeIterator
+        operator--(int)
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        StridedIntegralRangeIterator &
+        operator+=(difference_type n)
+        {
+            mIndex += n;
+            return *this;
+        }
+
+        StridedIntegralRangeIterator &
+        operator-=(difference_type n)
+        {
+            mIndex -= n;
+            return *this;
+        }
+
+        friend
+        StridedIntegralRangeIterator
+        operator+(StridedIntegralRangeIterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        friend
+        StridedIntegralRangeIterator
+        operator+(difference_type n, StridedIntegralRangeIterator it)
+        {
+            return it += n;
+        }
+
+        friend
+        StridedIntegralRangeIterator
+        operator-(StridedIntegralRangeIterator it, difference_type n)
+        {
+            return it -= n;
+        }
+
+    //'' iterators must be of same range.
+        friend
+        difference_type
+        operator-(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs)
+        {
+            return lhs.mIndex-rhs.mIndex;
+        }
+
+        friend bool operator==(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return lhs.mIndex==rhs.mIndex; }
+        friend bool operator!=(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return !(lhs==rhs); }
+        friend bool operator<(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return lhs.mIndex<rhs.mIndex; }
+        friend bool operator>(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return rhs<lhs; }
+        friend bool operator<=(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return !(rhs<lhs); }
+        friend bool operator>=(const StridedIntegralRangeIterator &lhs, const StridedIntegralRangeIterator &rhs) { return !(lhs<rhs); }
+
+private:
+    IntType mFirst;
+    difference_type mIndex;
+    std::size_t mStride;
+
+    //'' value of step [index] in iterating direction, by unsigned arithmetic to wrap instead of overflow.
+        IntType
+        ValueAt(difference_type index)
+        const
+        {
+            using UIntType = typename std::make_unsigned<IntType>::type;
+            auto offset = static_cast<UIntType>(static_cast<std::size_t>(index)*mStride);
+            if (Step>0)
+            {
+                return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(mFirst)+offset));
+            }
+            return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(mFirst)-offset));
+        }
+};
+
+}}
+
+namespace ies
+{
+
+//! @brief Every [stride]-th value of IntegralRange in its iterating direction, starting from its first value.
+//! e.g. Stride(IntRange(0, 10), 3) = {0, 3, 6, 9}, Stride(ReverseIntRange(0, 10), 4) = {9, 5, 1}.
+//! @note Iterator is random access for std::ranges, in C++20 StridedIntegralRange is std::ranges::view and borrowed_range.
+//! @example
+//!     //'' top-left corner of each 16x16 tile.
+//!     for (auto y : Stride(IndexRange{0, height}, 16))
+//!     {
+//!         for (auto x : Stride(IndexRange{0, width}, 16)) { ProcessTile(y, x); }
+//!     }
+template <typename IntType, RangeDirection Direction=RangeDirection::Forward>
+class StridedIntegralRange
+{
+public:
+    using IteratorType = Detail::StridedIntegralRangeIterator<IntType, Direction==RangeDirection::Forward ? 1 : -1>;
+
+    //! @throw std::runtime_error if stride is 0.
+        StridedIntegralRange(const IntegralRange<IntType, Direction> &range, std::size_t stride)
+        :   mRange(range), mStride(stride)
+        {
+            if (stride==0)
+            {
+                throw std::runtime_error("StridedIntegralRange: stride cannot be 0.");
+            }
+        }
+
+        IteratorType
+        begin()
+        const
+        {
+            return IteratorType(*mRange.begin(), 0, mStride);
+        }
+
+        IteratorType
+        end()
+        const
+        {
+            return IteratorType(*mRange.begin(), static_cast<std::ptrdiff_t>(size()), mStride);
+        }
+
+    //! @brief Number of values, ceil(range.size()/stride).
+        std::size_t size() const { return mRange.empty() ? 0 : (mRange.size()-1)/mStride+1; }
+
+        bool empty() const { return mRange.empty(); }
+
+        const IntegralRange<IntType, Direction> & GetRange() const { return mRange; }
+
+        std::size_t GetStride() const { return mStride; }
+
+private:
+    IntegralRange<IntType, Direction> mRange;
+    std::size_t mStride;
+};
+
+//! @brief Create StridedIntegralRange of every [stride]-th value of range.
+//! @throw std::runtime_error if stride is 0.
+template <typename IntType, RangeDirection Direction>
+StridedIntegralRange<IntType, Direction>
+Stride(const IntegralRange<IntType, Direction> &range, std::size_t stride)
+{
+    return {range, stride};
+}
+
+}
+
+#if __cplusplus >= 202002L
+template <typename IntType, ies::RangeDirection Direction>
+inline constexpr bool std::ranges::enable_view<ies::StridedIntegralRange<IntType, Direction>> = true;
+
+template <typename IntType, ies::RangeDirection Direction>
+inline constexpr bool std::ranges::enable_borrowed_range<ies::StridedIntegralRange<IntType, Direction>> = true;
+#endif
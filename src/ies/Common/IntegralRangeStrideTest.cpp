@@ -0,0 +1,96 @@
+#include "ies/Common/IntegralRangeStride.hxx"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+static_assert(std::random_access_iterator<StridedIntegralRange<int>::IteratorType>);
+static_assert(std::ranges::view<StridedIntegralRange<std::size_t, RangeDirection::Reverse>>);
+static_assert(std::ranges::borrowed_range<StridedIntegralRange<int>>);
+static_assert(std::is_same_v<std::iterator_traits<StridedIntegralRange<int>::IteratorType>::iterator_category, std::input_iterator_tag>);
+
+namespace
+{
+
+template <typename Range>
+auto
+ToVector(const Range &range)
+{
+    std::vector<typename Range::IteratorType::value_type> values;
+    for (auto value : range)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+}
+
+TEST(IntegralRangeStride, Forward)
+{
+    auto range = Stride(IntRange{-2, 8}, 3);
+
+    EXPECT_EQ(4u, range.size());
+    EXPECT_EQ(3u, range.GetStride());
+    EXPECT_EQ((std::vector<int>{-2, 1, 4, 7}), ToVector(range));
+    EXPECT_EQ((std::vector<int>{-2, 1, 4}), ToVector(Stride(IntRange{-2, 7}, 3)));
+    ASSERT_EQ((std::vector<int>{-2}), ToVector(Stride(IntRange{-2, 8}, 100)));
+}
+
+TEST(IntegralRangeStride, Reverse)
+{
+    //'' starts from last value of range, end wraps below 0 for unsigned type.
+    EXPECT_EQ((std::vector<int>{9, 5, 1}), ToVector(Stride(ReverseIntRange{0, 10}, 4)));
+    ASSERT_EQ((std::vector<std::size_t>{9, 6, 3, 0}), ToVector(Stride(ReverseIndexRange{0, 10}, 3)));
+}
+
+TEST(IntegralRangeStride, Empty)
+{
+    auto range = Stride(IndexRange{5, 5, EmptyPolicy::Allow}, 2);
+
+    EXPECT_TRUE(range.empty());
+    EXPECT_EQ(0u, range.size());
+    EXPECT_EQ(range.begin(), range.end());
+    ASSERT_THROW(Stride(IntRange{0, 5}, 0), std::runtime_error);
+}
+
+TEST(IntegralRangeStride, RandomAccess)
+{
+    auto range = Stride(ReverseUIntRange{0, 20}, 4);
+    auto it = range.begin();
+
+    EXPECT_EQ(5, range.end()-range.begin());
+    EXPECT_EQ(-5, range.begin()-range.end());
+    EXPECT_EQ(11u, it[2]);
+    EXPECT_EQ(3u, *(range.end()-1));
+    EXPECT_EQ(range.end(), 5+it);
+    EXPECT_TRUE(it<range.end());
+    ASSERT_EQ(7u, *std::lower_bound(range.begin(), range.end(), 7u, std::greater<>{}));
+}
+
+TEST(IntegralRangeStride, TopOfType)
+{
+    //'' end value wraps past end of type, iterators still compare by step.
+    auto range = Stride(IntegralRange<unsigned char>{0, 255}, 128);
+    EXPECT_EQ(2u, range.size());
+    EXPECT_EQ(2, range.end()-range.begin());
+    EXPECT_EQ((std::vector<unsigned char>{0, 128}), ToVector(range));
+    EXPECT_EQ((std::vector<unsigned char>{254, 126}), ToVector(Stride(IntegralRange<unsigned char, RangeDirection::Reverse>{0, 255}, 128)));
+    EXPECT_EQ((std::vector<signed char>{-128, -28, 72}), ToVector(Stride(IntegralRange<signed char>{-128, 127}, 100)));
+
+    auto longRange = Stride(UIntRange{0u, 4000000000u}, 1);
+    EXPECT_EQ(4000000000, longRange.end()-longRange.begin());
+    EXPECT_TRUE(longRange.begin()<longRange.end());
+    ASSERT_EQ(3999999999u, *(longRange.end()-1));
+}
+
+}
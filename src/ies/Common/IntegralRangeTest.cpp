@@ -1,13 +1,29 @@
 #include "ies/Common/IntegralRange.hxx"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <limits>
 #include <list>
+#include <ranges>
+#include <type_traits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 namespace ies
 {
 
+static_assert(std::random_access_iterator<IntRange::IteratorType>);
+static_assert(std::random_access_iterator<ReverseIndexRange::IteratorType>);
+static_assert(std::ranges::view<IntRange>);
+static_assert(std::ranges::view<ReverseUIntRange>);
+static_assert(std::ranges::borrowed_range<IndexRange>);
+static_assert(std::ranges::random_access_range<ReverseIntRange>);
+static_assert(std::ranges::sized_range<IntRange>);
+static_assert(std::is_same_v<std::iterator_traits<IntRange::IteratorType>::iterator_category, std::input_iterator_tag>);
+
 TEST(IntegralRange, EmptyRange)
 {
     IntRange range1{-2, -2, EmptyPolicy::Allow};
@@ -70,7 +86,7 @@ TEST(IntegralRange, Forward)
     std::list<int> actual;
     std::list<int> expected{0, 1, 2, 3, 4};
 
-    for (auto &element: range)
+    for (auto element: range)
     {
         actual.emplace_back(element);
     }
@@ -87,7 +103,7 @@ TEST(IntegralRange, Reverse)
     std::list<int> actual;
     std::list<int> expected{4, 3, 2, 1, 0};
 
-    for (auto &element: revRange)
+    for (auto element: revRange)
     {
         actual.emplace_back(element);
     }
@@ -103,7 +119,7 @@ TEST(IntegralRange, UIntReverse)
     std::list<int> actual;
     std::list<int> expected{2, 1, 0};
 
-    for (auto &element: range)
+    for (auto element: range)
     {
         actual.emplace_back(element);
     }
@@ -192,4 +208,97 @@ TEST(IntegralRange, ToString)
     ASSERT_EQ("[-1, 3)", s);
 }
 
+TEST(IntegralRange, RandomAccess)
+{
+    IntRange range{-3, 7};
+    auto it = range.begin();
+
+    EXPECT_EQ(10, range.end()-range.begin());
+    EXPECT_EQ(10, std::distance(range.begin(), range.end()));
+    EXPECT_EQ(2, *(it+5));
+    EXPECT_EQ(2, *(5+it));
+    EXPECT_EQ(4, it[7]);
+    EXPECT_EQ(-3, *((it+5)-5));
+    EXPECT_EQ(6, *(--range.end()));
+    EXPECT_TRUE(it<it+1);
+    EXPECT_TRUE(it+1>it);
+    EXPECT_TRUE(it<=it);
+    EXPECT_TRUE(it>=it);
+    EXPECT_EQ(-3, *it++);
+    EXPECT_EQ(-2, *it--);
+    EXPECT_EQ(range.begin(), it);
+    ASSERT_EQ(3, *std::lower_bound(range.begin(), range.end(), 3));
+}
+
+TEST(IntegralRange, ReverseRandomAccess)
+{
+    //'' end of reverse range [0, 5) is value before 0, which wraps for unsigned type.
+    ReverseUIntRange range{0, 5};
+    auto it = range.begin();
+
+    EXPECT_EQ(5, range.end()-range.begin());
+    EXPECT_EQ(-5, range.begin()-range.end());
+    EXPECT_EQ(1u, it[3]);
+    EXPECT_EQ(0u, *(range.end()-1));
+    EXPECT_EQ(range.end(), it+5);
+    EXPECT_TRUE(it<range.end());
+    EXPECT_TRUE(range.end()>it+4);
+    ASSERT_EQ(2u, *std::lower_bound(range.begin(), range.end(), 2u, std::greater<>{}));
+}
+
+TEST(IntegralRange, DistanceLongerThanSignedMax)
+{
+    UIntRange range{0u, 3000000000u};
+    EXPECT_EQ(3000000000, range.end()-range.begin());
+    EXPECT_EQ(-3000000000, range.begin()-range.end());
+    EXPECT_EQ(3000000000, std::ranges::distance(range));
+    EXPECT_TRUE(range.begin()<range.end());
+    EXPECT_FALSE(range.end()<range.begin());
+    EXPECT_EQ(2999999999u, *std::ranges::lower_bound(range, 2999999999u));
+
+    //'' end of reverse range [0, n) wraps to UINT_MAX.
+    ReverseUIntRange reverseRange{0u, 3000000000u};
+    EXPECT_EQ(3000000000, reverseRange.end()-reverseRange.begin());
+    EXPECT_TRUE(reverseRange.begin()<reverseRange.end());
+    EXPECT_EQ(0u, *(reverseRange.end()-1));
+    ASSERT_EQ(5u, *std::ranges::lower_bound(reverseRange, 5u, std::greater<>{}));
+}
+
+TEST(IntegralRange, Distance8Bit)
+{
+    IntegralRange<std::int8_t> signedRange{-100, 100};
+    EXPECT_EQ(200, signedRange.end()-signedRange.begin());
+    EXPECT_EQ(200, std::distance(signedRange.begin(), signedRange.end()));
+    EXPECT_TRUE(signedRange.begin()<signedRange.end());
+
+    IntegralRange<std::uint8_t> unsignedRange{0, 200};
+    EXPECT_EQ(200, unsignedRange.end()-unsignedRange.begin());
+    EXPECT_TRUE(unsignedRange.begin()<unsignedRange.end());
+
+    IntegralRange<std::int8_t, RangeDirection::Reverse> reverseSignedRange{-128, 127};
+    EXPECT_EQ(255, reverseSignedRange.end()-reverseSignedRange.begin());
+    EXPECT_TRUE(reverseSignedRange.begin()<reverseSignedRange.end());
+
+    IntegralRange<std::uint8_t, RangeDirection::Reverse> reverseUnsignedRange{0, 200};
+    EXPECT_EQ(200, reverseUnsignedRange.end()-reverseUnsignedRange.begin());
+    ASSERT_EQ(std::uint8_t{7}, *std::ranges::lower_bound(reverseUnsignedRange, std::uint8_t{7}, std::greater<>{}));
+}
+
+TEST(IntegralRange, Views)
+{
+    std::vector<int> actual;
+    std::vector<int> expected{9, 7, 5};
+    auto isOdd = [](int i){ return i%2!=0; };
+
+    for (auto i : ReverseIntRange{0, 10} | std::views::filter(isOdd) | std::views::take(3))
+    {
+        actual.push_back(i);
+    }
+    auto found = std::ranges::find(IntRange{0, 10}, 4);
+
+    EXPECT_EQ(expected, actual);
+    EXPECT_EQ(4, *found);
+    ASSERT_EQ(5, std::ranges::distance(IntRange{0, 10} | std::views::drop(5)));
+}
+
 }
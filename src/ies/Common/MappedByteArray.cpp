@@ -0,0 +1,259 @@
+#include "ies/Common/MappedByteArray.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ies
+{
+
+namespace
+{
+
+#ifndef _WIN32
+
+[[noreturn]]
+void
+ThrowSystemError(const std::string &action, const std::string &filePath)
+{
+    throw std::runtime_error("MappedByteArray: cannot "+action+" ["+filePath+"]: "+std::strerror(errno));
+}
+
+int
+ToAdvice(MappedAccessHint hint)
+{
+    switch (hint)
+    {
+        case MappedAccessHint::Sequential:
+            return MADV_SEQUENTIAL;
+        case MappedAccessHint::Random:
+            return MADV_RANDOM;
+        case MappedAccessHint::WillNeed:
+            return MADV_WILLNEED;
+        case MappedAccessHint::Normal:
+        default:
+            return MADV_NORMAL;
+    }
+}
+
+#endif
+
+}
+
+MappedByteArray::
+MappedByteArray(const std::string &filePath, MappedAccessHint hint, bool useHugePages)
+{
+#ifdef _WIN32
+    (void)useHugePages;
+    auto file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file==INVALID_HANDLE_VALUE)
+    {
+        throw std::runtime_error("MappedByteArray: cannot open ["+filePath+"], error ["+std::to_string(GetLastError())+"].");
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("MappedByteArray: cannot get size of ["+filePath+"], error ["+std::to_string(GetLastError())+"].");
+    }
+    if (fileSize.QuadPart==0)
+    {
+        CloseHandle(file);
+        return;
+    }
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    auto* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        auto error = GetLastError();
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        throw std::runtime_error("MappedByteArray: cannot map ["+filePath+"], error ["+std::to_string(error)+"].");
+    }
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mData = static_cast<const Byte*>(view);
+    mSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    auto fd = ::open(filePath.c_str(), O_RDONLY|O_CLOEXEC);
+    if (fd<0)
+    {
+        ThrowSystemError("open", filePath);
+    }
+    struct stat fileStat{};
+    if (::fstat(fd, &fileStat)!=0)
+    {
+        auto error = errno;
+        ::close(fd);
+        errno = error;
+        ThrowSystemError("get size of", filePath);
+    }
+    auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+    if (fileSize==0)
+    {
+        ::close(fd);
+        return;
+    }
+    auto* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    //'' mapping keeps file referenced, fd is not needed after mmap.
+    auto error = errno;
+    ::close(fd);
+    if (address==MAP_FAILED)
+    {
+        errno = error;
+        ThrowSystemError("map", filePath);
+    }
+    mData = static_cast<const Byte*>(address);
+    mSize = fileSize;
+
+#ifdef MADV_HUGEPAGE
+    if (useHugePages)
+    {
+        //'' best effort, fails if kernel does not support huge pages of file mapping.
+        ::madvise(address, mSize, MADV_HUGEPAGE);
+    }
+#else
+    (void)useHugePages;
+#endif
+    Advise(hint);
+#endif
+}
+
+MappedByteArray::
+~MappedByteArray()
+{
+    Unmap();
+}
+
+MappedByteArray::
+MappedByteArray(MappedByteArray &&other) noexcept
+:   mData(std::exchange(other.mData, nullptr)),
+    mSize(std::exchange(other.mSize, 0))
+#ifdef _WIN32
+    , mFileHandle(std::exchange(other.mFileHandle, nullptr)),
+    mMappingHandle(std::exchange(other.mMappingHandle, nullptr))
+#endif
+{
+}
+
+MappedByteArray &
+MappedByteArray::
+operator=(MappedByteArray &&other) noexcept
+{
+    if (this!=&other)
+    {
+        Unmap();
+        mData = std::exchange(other.mData, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+#ifdef _WIN32
+        mFileHandle = std::exchange(other.mFileHandle, nullptr);
+        mMappingHandle = std::exchange(other.mMappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+const Byte*
+MappedByteArray::
+data()
+const
+{
+    return mData;
+}
+
+std::size_t
+MappedByteArray::
+size()
+const
+{
+    return mSize;
+}
+
+bool
+MappedByteArray::
+empty()
+const
+{
+    return mSize==0;
+}
+
+const Byte*
+MappedByteArray::
+begin()
+const
+{
+    return mData;
+}
+
+const Byte*
+MappedByteArray::
+end()
+const
+{
+    return mData+mSize;
+}
+
+std::span<const Byte>
+MappedByteArray::
+GetSpan()
+const
+{
+    return {mData, mSize};
+}
+
+void
+MappedByteArray::
+Advise(MappedAccessHint hint)
+const
+{
+#ifdef _WIN32
+    (void)hint;
+#else
+    if (mData)
+    {
+        ::madvise(const_cast<Byte*>(mData), mSize, ToAdvice(hint));
+    }
+#endif
+}
+
+void
+MappedByteArray::
+Unmap()
+{
+    if (!mData)
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(mData);
+    CloseHandle(mMappingHandle);
+    CloseHandle(mFileHandle);
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+#else
+    ::munmap(const_cast<Byte*>(mData), mSize);
+#endif
+    mData = nullptr;
+    mSize = 0;
+}
+
+}
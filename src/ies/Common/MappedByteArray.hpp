@@ -0,0 +1,98 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <span>
+#include <string>
+
+#include "ies/Common/Byte.hpp"
+#include "ies/Common/SmartEnum.hxx"
+
+namespace ies
+{
+
+//! @brief Expected access pattern of MappedByteArray, for OS read-ahead (madvise).
+//! WillNeed: start reading whole file into page cache in background.
+IES_SMART_ENUM(MappedAccessHint,
+    Normal,
+    Sequential,
+    Random,
+    WillNeed
+);
+
+//! @brief Read-only memory mapped file, used like const ByteArray without copying file into heap.
+//! Has data(), size(), begin() and end(), so can be used by ToString(data, begin, end), ToBigEndian(), ByteReader
+//! and std::span<const Byte>.
+//! @note Content is undefined if file is modified or truncated by others while mapped.
+//! @note Hints and huge pages are advice to OS: ignored on Windows, and huge pages of file mapping
+//! only take effect if kernel supports it (e.g. Linux CONFIG_READ_ONLY_THP_FOR_FS).
+//! @example
+//!     MappedByteArray file{"capture.bin", MappedAccessHint::Sequential};
+//!     ByteReader reader{file};
+//!     std::cout << ToString(file.data(), 0, 64, "capture.bin");
+class IES_EXPORT MappedByteArray
+{
+public:
+    //! @brief Empty array, not mapping any file.
+        MappedByteArray() = default;
+
+    //! @brief Map whole file [filePath]. Empty file is mapped as empty array.
+    //! @throw std::runtime_error if file cannot be opened or mapped.
+        explicit MappedByteArray(const std::string &filePath, MappedAccessHint hint=MappedAccessHint::Normal, bool useHugePages=false);
+
+        ~MappedByteArray();
+
+        MappedByteArray(const MappedByteArray &) = delete;
+        MappedByteArray &
+        operator=(const MappedByteArray &) = delete;
+
+        MappedByteArray(MappedByteArray &&other) noexcept;
+        MappedByteArray &
+        operator=(MappedByteArray &&other) noexcept;
+
+        const Byte*
+        data()
+        const;
+
+        std::size_t
+        size()
+        const;
+
+        bool
+        empty()
+        const;
+
+        const Byte*
+        begin()
+        const;
+
+        const Byte*
+        end()
+        const;
+
+        std::span<const Byte>
+        GetSpan()
+        const;
+
+    //! @brief Change access hint, e.g. Random after a sequential scan.
+        void
+        Advise(MappedAccessHint hint)
+        const;
+
+private:
+    const Byte* mData{nullptr};
+    std::size_t mSize{0};
+#ifdef _WIN32
+    void* mFileHandle{nullptr};
+    void* mMappingHandle{nullptr};
+#endif
+
+        void
+        Unmap();
+};
+
+}
@@ -0,0 +1,71 @@
+#include "ies/Common/MappedByteArray.hpp"
+
+#include "ies/Common/ByteCursor.hxx"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ies
+{
+
+namespace
+{
+
+std::string
+WriteTempFile(const std::string &fileName, const ByteArray &content)
+{
+    auto path = (std::filesystem::temp_directory_path()/fileName).string();
+    std::ofstream file{path, std::ios::binary};
+    file.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size()));
+    return path;
+}
+
+}
+
+TEST(MappedByteArray, Map)
+{
+    ByteArray content(100000);
+    for (std::size_t i = 0; i<content.size(); ++i)
+    {
+        content[i] = static_cast<Byte>(i*7);
+    }
+    auto path = WriteTempFile("ies_MappedByteArrayTest.bin", content);
+
+    MappedByteArray mapped{path, MappedAccessHint::Sequential, true};
+    ASSERT_EQ(content.size(), mapped.size());
+    EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), content.begin()));
+    EXPECT_EQ(ToString(content, 10, 50), ToString(mapped.data(), 10, 50));
+    mapped.Advise(MappedAccessHint::Random);
+
+    ByteReader reader{mapped};
+    reader.Seek(16);
+    EXPECT_EQ(ToBigEndian<uint32_t>(content.data()+16), reader.ReadBigEndian<uint32_t>());
+
+    auto moved = std::move(mapped);
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(nullptr, mapped.data());
+    EXPECT_EQ(content.size(), moved.GetSpan().size());
+    moved = MappedByteArray{};
+    EXPECT_TRUE(moved.empty());
+
+    std::filesystem::remove(path);
+    ASSERT_THROW(MappedByteArray{path}, std::runtime_error);
+}
+
+TEST(MappedByteArray, EmptyFile)
+{
+    auto path = WriteTempFile("ies_MappedByteArrayTest_empty.bin", {});
+    MappedByteArray mapped{path};
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(mapped.begin(), mapped.end());
+    std::filesystem::remove(path);
+    ASSERT_EQ(ToString(ByteArray{}), ToString(mapped.data(), 0, mapped.size()));
+}
+
+}
@@ -9,11 +9,27 @@ NamedObject(std::string name)
 {
 }
 
+NamedObject::
+NamedObject(Symbol name)
+:   mName(StringInterner::GetGlobal().GetString(name)),
+    mNameSymbol(name)
+{
+}
+
 void
 NamedObject::
 SetName(const std::string &name)
 {
     mName = name;
+    mNameSymbol.reset();
+}
+
+void
+NamedObject::
+SetName(Symbol name)
+{
+    mName = StringInterner::GetGlobal().GetString(name);
+    mNameSymbol = name;
 }
 
 const std::string &
@@ -24,6 +40,14 @@ const
     return mName;
 }
 
+std::optional<Symbol>
+NamedObject::
+GetNameSymbol()
+const
+{
+    return mNameSymbol;
+}
+
 std::string
 ToString(const NamedObject &object)
 {
@@ -9,6 +9,9 @@
 
 #include "ies/ies_export.h"
 
+#include "ies/String/StringInterner.hpp"
+
+#include <optional>
 #include <string>
 
 namespace ies
@@ -16,21 +19,35 @@ namespace ies
 
 //! @class NamedObject
 //! @brief An object with name. Name can be empty.
+//! @note Opt-in interning: construct or SetName with Symbol of StringInterner::GetGlobal() to keep the Symbol,
+//! e.g. to compare or hash names by id. Names set by string are never interned.
 class IES_EXPORT NamedObject
 {
 public:
         explicit NamedObject(std::string name);
+    //! @brief Construct with [name] interned by StringInterner::GetGlobal().
+        explicit NamedObject(Symbol name);
         ~NamedObject() = default;
 
         void
         SetName(const std::string &name);
 
+    //! @brief Set name to [name] interned by StringInterner::GetGlobal().
+        void
+        SetName(Symbol name);
+
         const std::string &
         GetName()
         const;
 
+    //! @brief Symbol of name if it was last set by Symbol, otherwise std::nullopt.
+        std::optional<Symbol>
+        GetNameSymbol()
+        const;
+
 private:
     std::string mName;
+    std::optional<Symbol> mNameSymbol;
 };
 
 IES_EXPORT
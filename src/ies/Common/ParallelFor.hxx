@@ -0,0 +1,219 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ies/Common/IntegralRange.hxx"
+#include "ies/Common/ThreadPool.hpp"
+
+// NOLINTNEXTLINE(modernize-concat-nested-namespaces)
+namespace ies { namespace Detail {
+
+//'' chunks per thread when grain size is chosen automatically, so stealing can balance uneven work.
+constexpr std::size_t ParallelChunksPerThread = 8;
+
+//'' Range split into chunks of grainSize values in iterating order of Direction, chunk c is c-th piece iterated.
+template <typename IntType, RangeDirection Direction>
+class ParallelChunks
+{
+public:
+        ParallelChunks(const IntegralRange<IntType, Direction> &range, std::size_t grainSize, const ThreadPool &pool)
+        :   mBegin(range.GetBegin()), mSize(range.size())
+        {
+            if (grainSize==0)
+            {
+                grainSize = std::max(std::size_t{1}, mSize/(pool.GetThreadCount()*ParallelChunksPerThread));
+            }
+            mGrainSize = grainSize;
+            mCount = (mSize+grainSize-1)/grainSize;
+        }
+
+        std::size_t
+        GetCount()
+        const
+        {
+            return mCount;
+        }
+
+    //'' call body(value) for values of chunk in iterating order.
+        template <typename Body>
+        void
+        ForEach(std::size_t chunk, Body &body)
+        const
+        {
+            auto offset = chunk*mGrainSize;
+            auto size = std::min(mGrainSize, mSize-offset);
+            if constexpr (Direction==RangeDirection::Forward)
+            {
+                auto value = Add(mBegin, offset);
+                for (std::size_t i = 0; i<size; ++i, ++value)
+                {
+                    body(value);
+                }
+            }
+            else
+            {
+                auto value = Add(mBegin, mSize-offset-1);
+                for (std::size_t i = 0; i<size; ++i, --value)
+                {
+                    body(value);
+                }
+            }
+        }
+
+private:
+    IntType mBegin;
+    std::size_t mSize;
+    std::size_t mGrainSize{1};
+    std::size_t mCount{0};
+
+    //'' by unsigned arithmetic, offset may not fit in signed IntType.
+        static
+        IntType
+        Add(IntType value, std::size_t offset)
+        {
+            using UIntType = typename std::make_unsigned<IntType>::type;
+            return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(value)+static_cast<UIntType>(offset)));
+        }
+};
+
+//'' Run runChunk(c) for c in [0, chunkCount) on pool and calling thread, return after all chunks are done.
+//'' Chunks are split in halves lazily: right half is submitted for stealing, left half is kept,
+//'' so idle workers steal large pieces and each thread mostly runs consecutive chunks.
+//'' First exception thrown by runChunk is rethrown, chunks not started yet are skipped.
+template <typename RunChunk>
+class ForkJoin
+{
+public:
+        ForkJoin(ThreadPool &pool, RunChunk &runChunk)
+        :   mPool(pool), mRunChunk(runChunk)
+        {}
+
+        void
+        Run(std::size_t chunkCount)
+        {
+            if (chunkCount==0)
+            {
+                return;
+            }
+            mRemainingCount.store(chunkCount);
+            Split(0, chunkCount);
+            mPool.RunPendingTasksUntil([this]{ return mRemainingCount.load(std::memory_order_acquire)==0; });
+            if (mError)
+            {
+                std::rethrow_exception(mError);
+            }
+        }
+
+private:
+    ThreadPool &mPool;
+    RunChunk &mRunChunk;
+    std::atomic<std::size_t> mRemainingCount{0};
+    std::atomic<bool> mIsFailed{false};
+    std::exception_ptr mError;
+
+        void
+        Split(std::size_t begin, std::size_t end)
+        {
+            while (end-begin>1)
+            {
+                auto middle = begin+(end-begin)/2;
+                mPool.Submit([this, middle, end]{ Split(middle, end); });
+                end = middle;
+            }
+            if (!mIsFailed.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    mRunChunk(begin);
+                }
+                catch (...)
+                {
+                    if (!mIsFailed.exchange(true))
+                    {
+                        mError = std::current_exception();
+                    }
+                }
+            }
+            //'' must be last access of this, Run() may return right after last chunk is counted.
+            auto &pool = mPool;
+            if (mRemainingCount.fetch_sub(1, std::memory_order_acq_rel)==1)
+            {
+                pool.NotifyDone();
+            }
+        }
+};
+
+}}
+
+namespace ies
+{
+
+//! @brief Call body(value) for each value of range in parallel on [pool], calling thread also runs chunks.
+//! Range is split into chunks of [grainSize] values (0: about 8 chunks per thread), values in one chunk are
+//! iterated in order of range's RangeDirection by one thread. Empty range (EmptyPolicy::Allow) does nothing.
+//! @note Order between chunks is not specified, body must be safe to run concurrently.
+//! @note ParallelFor can be nested: waiting thread runs pending tasks, and only sleeps when no task is pending.
+//! @throw first exception thrown by body, after all running chunks finish.
+//! @example
+//!     ParallelFor(IndexRange{0, pixels.size()}, [&](std::size_t i){ pixels[i] = Shade(i); });
+template <typename IntType, RangeDirection Direction, typename Body>
+void
+ParallelFor(const IntegralRange<IntType, Direction> &range,
+            Body body,
+            std::size_t grainSize=0,
+            ThreadPool &pool=ThreadPool::GetGlobal())
+{
+    const Detail::ParallelChunks<IntType, Direction> chunks{range, grainSize, pool};
+    auto runChunk = [&](std::size_t chunk) { chunks.ForEach(chunk, body); };
+    Detail::ForkJoin<decltype(runChunk)> forkJoin{pool, runChunk};
+    forkJoin.Run(chunks.GetCount());
+}
+
+//! @brief Parallel version of folding reduce(accumulated, transform(value)) over values of range from [identity].
+//! Each chunk folds its values in iterating order from identity, then chunk results are folded in chunk order,
+//! so result is deterministic for same grainSize, and equal to serial fold if reduce is associative.
+//! @note Same as std::transform_reduce, reduce must be associative and identity must be its identity element.
+//! @throw first exception thrown by transform or reduce.
+//! @example
+//!     auto sum = ParallelReduce(IndexRange{0, v.size()}, 0.0,
+//!                               [&](std::size_t i){ return v[i]*v[i]; },
+//!                               std::plus<>{});
+template <typename IntType, RangeDirection Direction, typename T, typename Transform, typename Reduce>
+T
+ParallelReduce(const IntegralRange<IntType, Direction> &range,
+               T identity,
+               Transform transform,
+               Reduce reduce,
+               std::size_t grainSize=0,
+               ThreadPool &pool=ThreadPool::GetGlobal())
+{
+    const Detail::ParallelChunks<IntType, Direction> chunks{range, grainSize, pool};
+    std::vector<T> chunkResults(chunks.GetCount(), identity);
+    auto runChunk = [&](std::size_t chunk)
+    {
+        auto accumulated = identity;
+        auto fold = [&](IntType value) { accumulated = reduce(std::move(accumulated), transform(value)); };
+        chunks.ForEach(chunk, fold);
+        chunkResults[chunk] = std::move(accumulated);
+    };
+    Detail::ForkJoin<decltype(runChunk)> forkJoin{pool, runChunk};
+    forkJoin.Run(chunks.GetCount());
+
+    auto result = std::move(identity);
+    for (auto &chunkResult : chunkResults)
+    {
+        result = reduce(std::move(result), std::move(chunkResult));
+    }
+    return result;
+}
+
+}
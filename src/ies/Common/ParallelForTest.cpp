@@ -0,0 +1,88 @@
+#include "ies/Common/ParallelFor.hxx"
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+TEST(ParallelFor, VisitEachValueOnce)
+{
+    ThreadPool pool{4};
+    std::vector<std::atomic<int>> visits(10007);
+
+    ParallelFor(IndexRange{0, visits.size()}, [&](std::size_t i){ ++visits[i]; }, 0, pool);
+    ParallelFor(ReverseIndexRange{0, visits.size()}, [&](std::size_t i){ ++visits[i]; }, 3, pool);
+    ParallelFor(IntRange{-5, 5}, [&](int i){ ++visits[static_cast<std::size_t>(i+5)]; }, 1, pool);
+
+    for (std::size_t i = 0; i<visits.size(); ++i)
+    {
+        ASSERT_EQ(i<10 ? 3 : 2, visits[i].load());
+    }
+}
+
+TEST(ParallelFor, EmptyRange)
+{
+    std::atomic<int> count{0};
+
+    ParallelFor(IntRange{3, 3, EmptyPolicy::Allow}, [&](int){ ++count; });
+
+    EXPECT_EQ(0, count.load());
+    ASSERT_EQ(7, ParallelReduce(IntRange{3, 3, EmptyPolicy::Allow}, 7, [](int i){ return i; }, std::plus<>{}));
+}
+
+TEST(ParallelFor, ReduceInIteratingOrder)
+{
+    ThreadPool pool{4};
+    auto toString = [](int i){ return std::to_string(i)+","; };
+    std::string expected;
+    std::string reverseExpected;
+    for (auto i : IntRange{0, 200})
+    {
+        expected += toString(i);
+    }
+    for (auto i : ReverseIntRange{0, 200})
+    {
+        reverseExpected += toString(i);
+    }
+
+    //'' string concatenation is associative but not commutative.
+    EXPECT_EQ(expected, ParallelReduce(IntRange{0, 200}, std::string{}, toString, std::plus<>{}, 7, pool));
+    EXPECT_EQ(reverseExpected, ParallelReduce(ReverseIntRange{0, 200}, std::string{}, toString, std::plus<>{}, 7, pool));
+    ASSERT_EQ(199LL*200/2, ParallelReduce(IntRange{0, 200}, 0LL, [](int i){ return static_cast<long long>(i); }, std::plus<>{}, 0, pool));
+}
+
+TEST(ParallelFor, Nested)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+
+    ParallelFor(IntRange{0, 20}, [&](int)
+    {
+        ParallelFor(IntRange{0, 50}, [&](int){ ++count; }, 5, pool);
+    }, 1, pool);
+
+    ASSERT_EQ(1000, count.load());
+}
+
+TEST(ParallelFor, Throw)
+{
+    ThreadPool pool{2};
+
+    ASSERT_THROW(
+        ParallelFor(IntRange{0, 1000}, [](int i)
+        {
+            if (i==500)
+            {
+                throw std::runtime_error("error");
+            }
+        }, 10, pool);
+    , std::runtime_error);
+}
+
+}
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "ies/Common/IntegralRange.hxx"
+#include "ies/Common/SmartEnum.hxx"
+
+namespace ies
+{
+
+//! @brief Visiting order of ProductRange.
+//! RowMajor: last dimension changes fastest, e.g. (y, x) visits each row in turn.
+//! ColumnMajor: first dimension changes fastest.
+//! Tiled: row-major order of tiles, row-major inside each tile. Tiles at the edges are clipped.
+//! Morton: Z-order curve, interleaved bits of coordinates with last dimension as lowest bit.
+IES_SMART_ENUM(ProductOrder,
+    RowMajor,
+    ColumnMajor,
+    Tiled,
+    Morton
+);
+
+//! @brief Cartesian product of N forward IntegralRanges, iterates index tuples (std::array<IntType, N>) in ProductOrder.
+//! Replaces nested loops over IndexRanges, and expresses cache-blocked traversal once for different kernels.
+//! @note Iterator is forward iterator and refers to ProductRange, range must outlive its iterators.
+//! @note Morton order iterates Z-order of grid padded to power of 2 per dimension and skips padded cells,
+//! so at most 2^N cells are visited per index. Sum of bits of padded sizes must be less than 64.
+//! @example
+//!     ProductRange<std::size_t, 2> tiles{{IndexRange{0, height}, IndexRange{0, width}}, {32, 32}};
+//!     for (auto [y, x] : tiles) { output[x*height+y] = input[y*width+x]; }
+template <typename IntType, std::size_t N>
+class ProductRange
+{
+public:
+    static_assert(N>0, "ProductRange needs at least one dimension.");
+
+    using ValueType = std::array<IntType, N>;
+    using RangesType = std::array<IntegralRange<IntType>, N>;
+    using TileSizeType = std::array<std::size_t, N>;
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ValueType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ValueType;
+
+            Iterator() = default;
+
+            Iterator(const ProductRange* range, std::size_t index)
+            :   mRange(range), mIndex(index), mInnerEnd(range->GetInnerEnd(mTileStart))
+            {}
+
+            ValueType
+            operator*()
+            const
+            {
+                ValueType value{};
+                for (std::size_t d = 0; d<N; ++d)
+                {
+                    value[d] = mRange->GetValue(d, mOffset[d]);
+                }
+                //'' constant index for each case, so value can stay in registers.
+                if (mRange->mInnerDimension==0)
+                {
+                    value[0] = mRange->GetValue(0, mInner);
+                }
+                else
+                {
+                    value[N-1] = mRange->GetValue(N-1, mInner);
+                }
+                return value;
+            }
+
+            Iterator &
+            operator++()
+            {
+                ++mIndex;
+                //'' fast path: step in fastest changing dimension inside current row or tile.
+                if (mInner+1<mInnerEnd)
+                {
+                    ++mInner;
+                    return *this;
+                }
+                if (mIndex==mRange->mSize)
+                {
+                    return *this;
+                }
+                mOffset[mRange->mInnerDimension] = mInner;
+                switch (mRange->mOrder)
+                {
+                case ProductOrder::RowMajor: mRange->NextRowMajor(mOffset); break;
+                case ProductOrder::ColumnMajor: mRange->NextColumnMajor(mOffset); break;
+                case ProductOrder::Tiled: mRange->NextTiled(mOffset, mTileStart); break;
+                case ProductOrder::Morton: mRange->NextMorton(mOffset, mCode); break;
+                }
+                mInner = mOffset[mRange->mInnerDimension];
+                mInnerEnd = mRange->GetInnerEnd(mTileStart);
+                return *this;
+            }
+
+            Iterator
+            operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+        //'' index of visited tuple identifies position, iterators must be of same range.
+            friend bool operator==(const Iterator &lhs, const Iterator &rhs) { return lhs.mIndex==rhs.mIndex; }
+            friend bool operator!=(const Iterator &lhs, const Iterator &rhs) { return !(lhs==rhs); }
+
+    private:
+        const ProductRange* mRange{nullptr};
+        std::size_t mIndex{0};
+        //'' offsets from begin of each range (offset of fastest changing dimension is mInner),
+        //'' start of current tile (Tiled), Z-order code (Morton).
+        std::size_t mInner{0};
+        TileSizeType mOffset{};
+        TileSizeType mTileStart{};
+        std::uint64_t mCode{0};
+        std::size_t mInnerEnd{0};
+    };
+
+    //! @brief Product of ranges visited in order, Tiled order needs tileSize (use other constructor).
+    //! @throw std::runtime_error if order is Tiled, size overflows std::size_t, or Morton code needs 64 bits or more.
+        explicit ProductRange(const RangesType &ranges, ProductOrder order=ProductOrder::RowMajor)
+        :   mRanges(ranges), mOrder(order)
+        {
+            if (order==ProductOrder::Tiled)
+            {
+                throw std::runtime_error("ProductRange: Tiled order needs tile size.");
+            }
+            Initialize();
+        }
+
+    //! @brief Product of ranges visited in Tiled order with tileSize[d] values per tile in dimension d.
+    //! @throw std::runtime_error if any tile size is 0 or size overflows std::size_t.
+        ProductRange(const RangesType &ranges, const TileSizeType &tileSize)
+        :   mRanges(ranges), mOrder(ProductOrder::Tiled), mTileSize(tileSize)
+        {
+            for (auto size : tileSize)
+            {
+                if (size==0)
+                {
+                    throw std::runtime_error("ProductRange: tile size cannot be 0.");
+                }
+            }
+            Initialize();
+        }
+
+        Iterator
+        begin()
+        const
+        {
+            return Iterator{this, 0};
+        }
+
+        Iterator
+        end()
+        const
+        {
+            return Iterator{this, mSize};
+        }
+
+    //! @brief Number of tuples, product of sizes of ranges.
+        std::size_t size() const { return mSize; }
+
+        bool empty() const { return mSize==0; }
+
+        const RangesType & GetRanges() const { return mRanges; }
+
+        ProductOrder GetOrder() const { return mOrder; }
+
+    //! @brief Tile size of Tiled order, sizes of ranges for other orders.
+        const TileSizeType & GetTileSize() const { return mTileSize; }
+
+private:
+    RangesType mRanges;
+    ProductOrder mOrder;
+    TileSizeType mTileSize{};
+    TileSizeType mExtent{};
+    std::size_t mSize{1};
+    std::size_t mInnerDimension{N-1};
+
+    //'' Morton: for bit position p of code, its dimension, bit in coordinate,
+    //'' and count of bits of each dimension below p (cleared when carry passes p).
+    std::size_t mCodeBitCount{0};
+    std::array<std::size_t, 64> mCodeDimension{};
+    std::array<std::size_t, 64> mCodeBit{};
+    std::array<TileSizeType, 64> mLowBitCount{};
+
+        void
+        Initialize()
+        {
+            for (std::size_t d = 0; d<N; ++d)
+            {
+                mExtent[d] = mRanges[d].size();
+                if (mExtent[d]!=0 && mSize>std::numeric_limits<std::size_t>::max()/mExtent[d])
+                {
+                    throw std::runtime_error("ProductRange: size overflows std::size_t.");
+                }
+                mSize *= mExtent[d];
+            }
+            if (mOrder!=ProductOrder::Tiled)
+            {
+                mTileSize = mExtent;
+            }
+            if (mOrder==ProductOrder::ColumnMajor)
+            {
+                mInnerDimension = 0;
+            }
+            if (mOrder==ProductOrder::Morton && mSize!=0)
+            {
+                InitializeMorton();
+            }
+        }
+
+        void
+        InitializeMorton()
+        {
+            TileSizeType bitCount{};
+            std::size_t maxBitCount = 0;
+            for (std::size_t d = 0; d<N; ++d)
+            {
+                bitCount[d] = static_cast<std::size_t>(std::bit_width(mExtent[d]-1));
+                maxBitCount = std::max(maxBitCount, bitCount[d]);
+            }
+            TileSizeType assigned{};
+            for (std::size_t bit = 0; bit<maxBitCount; ++bit)
+            {
+                for (std::size_t i = 0; i<N; ++i)
+                {
+                    auto d = N-1-i;
+                    if (bit>=bitCount[d])
+                    {
+                        continue;
+                    }
+                    if (mCodeBitCount>=63)
+                    {
+                        throw std::runtime_error("ProductRange: Morton code of ranges needs more than 63 bits.");
+                    }
+                    mCodeDimension[mCodeBitCount] = d;
+                    mCodeBit[mCodeBitCount] = bit;
+                    mLowBitCount[mCodeBitCount] = assigned;
+                    ++assigned[d];
+                    ++mCodeBitCount;
+                }
+            }
+        }
+
+        IntType
+        GetValue(std::size_t dimension, std::size_t offset)
+        const
+        {
+            using UIntType = std::make_unsigned_t<IntType>;
+            return static_cast<IntType>(static_cast<UIntType>(static_cast<UIntType>(mRanges[dimension].GetBegin())
+                                                              +static_cast<UIntType>(offset)));
+        }
+
+    //'' end offset of fastest changing dimension in current row or tile, 0 (no fast path) for Morton.
+        std::size_t
+        GetInnerEnd(const TileSizeType &tileStart)
+        const
+        {
+            if (mOrder==ProductOrder::Morton)
+            {
+                return 0;
+            }
+            auto d = mInnerDimension;
+            return std::min(tileStart[d]+mTileSize[d], mExtent[d]);
+        }
+
+        void
+        NextRowMajor(TileSizeType &offset)
+        const
+        {
+            for (std::size_t i = 0; i<N; ++i)
+            {
+                auto d = N-1-i;
+                if (++offset[d]<mExtent[d])
+                {
+                    return;
+                }
+                offset[d] = 0;
+            }
+        }
+
+        void
+        NextColumnMajor(TileSizeType &offset)
+        const
+        {
+            for (std::size_t d = 0; d<N; ++d)
+            {
+                if (++offset[d]<mExtent[d])
+                {
+                    return;
+                }
+                offset[d] = 0;
+            }
+        }
+
+        void
+        NextTiled(TileSizeType &offset, TileSizeType &tileStart)
+        const
+        {
+            for (std::size_t i = 0; i<N; ++i)
+            {
+                auto d = N-1-i;
+                if (++offset[d]<std::min(tileStart[d]+mTileSize[d], mExtent[d]))
+                {
+                    return;
+                }
+                offset[d] = tileStart[d];
+            }
+            for (std::size_t i = 0; i<N; ++i)
+            {
+                auto d = N-1-i;
+                tileStart[d] += mTileSize[d];
+                if (tileStart[d]<mExtent[d])
+                {
+                    break;
+                }
+                tileStart[d] = 0;
+            }
+            offset = tileStart;
+        }
+
+    //'' code+1 sets bit p = countr_one(code) and clears bits below p, which are lowest bits of coordinates.
+    //'' Codes of padded cells are skipped, caller guarantees next cell exists.
+        void
+        NextMorton(TileSizeType &offset, std::uint64_t &code)
+        const
+        {
+            while (true)
+            {
+                auto p = static_cast<std::size_t>(std::countr_one(code));
+                ++code;
+                for (std::size_t d = 0; d<N; ++d)
+                {
+                    offset[d] = (offset[d]>>mLowBitCount[p][d])<<mLowBitCount[p][d];
+                }
+                offset[mCodeDimension[p]] |= std::size_t{1}<<mCodeBit[p];
+
+                auto isInside = true;
+                for (std::size_t d = 0; d<N; ++d)
+                {
+                    isInside = isInside && offset[d]<mExtent[d];
+                }
+                if (isInside)
+                {
+                    return;
+                }
+            }
+        }
+};
+
+//! @brief Create row-major ProductRange of ranges, e.g. MakeProductRange(IndexRange{0, h}, IndexRange{0, w}).
+template <typename IntType, typename... Ranges>
+ProductRange<IntType, 1+sizeof...(Ranges)>
+MakeProductRange(const IntegralRange<IntType> &range, const Ranges &... ranges)
+{
+    return ProductRange<IntType, 1+sizeof...(Ranges)>{{range, ranges...}};
+}
+
+}
@@ -0,0 +1,113 @@
+#include "ies/Common/ProductRange.hxx"
+
+#include <array>
+#include <cstddef>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+static_assert(std::forward_iterator<ProductRange<int, 3>::Iterator>);
+
+namespace
+{
+
+using Index2 = std::array<std::size_t, 2>;
+
+template <typename Range>
+auto
+ToVector(const Range &range)
+{
+    std::vector<typename Range::ValueType> values;
+    for (auto value : range)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+}
+
+TEST(ProductRange, RowMajor)
+{
+    auto range = MakeProductRange(IndexRange{0, 2}, IndexRange{5, 8});
+    std::vector<Index2> expected{{0, 5}, {0, 6}, {0, 7}, {1, 5}, {1, 6}, {1, 7}};
+
+    EXPECT_EQ(6u, range.size());
+    EXPECT_EQ(ProductOrder::RowMajor, range.GetOrder());
+    ASSERT_EQ(expected, ToVector(range));
+}
+
+TEST(ProductRange, ColumnMajor)
+{
+    ProductRange<int, 2> range{{IntRange{-1, 1}, IntRange{0, 3}}, ProductOrder::ColumnMajor};
+    std::vector<std::array<int, 2>> expected{{-1, 0}, {0, 0}, {-1, 1}, {0, 1}, {-1, 2}, {0, 2}};
+
+    ASSERT_EQ(expected, ToVector(range));
+}
+
+TEST(ProductRange, Tiled)
+{
+    //'' 3x5 grid in 2x2 tiles, edge tiles are clipped.
+    ProductRange<std::size_t, 2> range{{IndexRange{0, 3}, IndexRange{0, 5}}, {2, 2}};
+    std::vector<Index2> expected{
+        {0, 0}, {0, 1}, {1, 0}, {1, 1},
+        {0, 2}, {0, 3}, {1, 2}, {1, 3},
+        {0, 4}, {1, 4},
+        {2, 0}, {2, 1},
+        {2, 2}, {2, 3},
+        {2, 4}};
+
+    EXPECT_EQ((Index2{2, 2}), range.GetTileSize());
+    ASSERT_EQ(expected, ToVector(range));
+}
+
+TEST(ProductRange, Morton)
+{
+    ProductRange<std::size_t, 2> range{{IndexRange{0, 3}, IndexRange{0, 3}}, ProductOrder::Morton};
+    std::vector<Index2> expected{
+        {0, 0}, {0, 1}, {1, 0}, {1, 1},
+        {0, 2}, {1, 2},
+        {2, 0}, {2, 1},
+        {2, 2}};
+
+    ASSERT_EQ(expected, ToVector(range));
+}
+
+TEST(ProductRange, VisitAllOnce)
+{
+    std::array<IntegralRange<int>, 3> ranges{IntRange{-3, 4}, IntRange{0, 1}, IntRange{10, 23}};
+    std::vector<ProductRange<int, 3>> products{
+        ProductRange<int, 3>{ranges},
+        ProductRange<int, 3>{ranges, ProductOrder::ColumnMajor},
+        ProductRange<int, 3>{ranges, ProductOrder::Morton},
+        ProductRange<int, 3>{ranges, {3, 2, 5}}};
+
+    for (auto &product : products)
+    {
+        auto values = ToVector(product);
+        std::set<std::array<int, 3>> unique(values.begin(), values.end());
+        ASSERT_EQ(7u*1u*13u, values.size());
+        ASSERT_EQ(values.size(), unique.size());
+        for (auto &value : values)
+        {
+            ASSERT_TRUE(ranges[0].IsInRange(value[0]) && ranges[1].IsInRange(value[1]) && ranges[2].IsInRange(value[2]));
+        }
+    }
+}
+
+TEST(ProductRange, Empty)
+{
+    ProductRange<std::size_t, 2> range{{IndexRange{0, 4}, IndexRange{2, 2, EmptyPolicy::Allow}}, ProductOrder::Morton};
+
+    EXPECT_TRUE(range.empty());
+    EXPECT_EQ(range.begin(), range.end());
+    EXPECT_THROW((ProductRange<int, 1>{{IntRange{0, 4}}, ProductOrder::Tiled}), std::runtime_error);
+    ASSERT_THROW((ProductRange<int, 1>{{IntRange{0, 4}}, {0}}), std::runtime_error);
+}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+//! [C++11 Compatible]
+#include "ies/StdUtil/RequireCpp11.hpp" // IWYU pragma: keep
+
+//! @brief Compile time detection of SIMD instruction sets used by SIMD kernels in library.
+//! Kernels always have scalar fallback, so IES_SIMD_* only select faster path.
+//! IES_SIMD_SSE2: x86-64 baseline (always available for x64 GCC/Clang/MSVC).
+//! IES_SIMD_SSSE3: only when compiler is told target supports it (e.g. -mssse3, -march=native).
+//! IES_SIMD_AVX2: only when compiler is told target supports it (e.g. -mavx2, /arch:AVX2).
+//! @note Define IES_DISABLE_SIMD to force scalar fallback, e.g. to compare kernel results.
+
+#if !defined(IES_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2))
+    #define IES_SIMD_SSE2 1
+#else
+    #define IES_SIMD_SSE2 0
+#endif
+
+#if IES_SIMD_SSE2 && (defined(__SSSE3__) || defined(__AVX__))
+    #define IES_SIMD_SSSE3 1
+#else
+    #define IES_SIMD_SSSE3 0
+#endif
+
+#if IES_SIMD_SSE2 && defined(__AVX2__)
+    #define IES_SIMD_AVX2 1
+#else
+    #define IES_SIMD_AVX2 0
+#endif
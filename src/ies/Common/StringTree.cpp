@@ -2,6 +2,7 @@
 
 #include <functional>
 #include <stdexcept>
+#include <utility>
 
 #include "ies/Common/IntegralRange.hxx"
 #include "ies/StdUtil/Find.hxx"
@@ -418,7 +419,7 @@ GetAncestor(const std::string &nodeName, int distance)
 const
 {
     auto ancestor = nodeName;
-    for (auto &l : IntRange{0, distance, EmptyPolicy::Allow})
+    for (auto l : IntRange{0, distance, EmptyPolicy::Allow})
     {
         (void)l;
         ancestor = GetParentNode(ancestor);
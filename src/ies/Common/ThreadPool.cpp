@@ -0,0 +1,248 @@
+#include "ies/Common/ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+struct WorkerQueue
+{
+    std::mutex Mutex;
+    std::deque<std::function<void()>> Tasks;
+};
+
+}
+
+struct ThreadPool::State
+{
+    std::vector<std::unique_ptr<WorkerQueue>> Queues;
+    std::vector<std::thread> Threads;
+    std::atomic<std::size_t> PendingCount{0};
+    std::atomic<std::size_t> NextQueue{0};
+
+    //'' idle workers and RunPendingTasksUntil() sleep on SleepCondition, submit only locks SleepMutex when some thread sleeps.
+    std::mutex SleepMutex;
+    std::condition_variable SleepCondition;
+    std::atomic<std::size_t> SleepingCount{0};
+    bool IsStopping{false};
+
+        void
+        Push(std::size_t queueIndex, std::function<void()> task);
+
+        bool
+        RunPendingTask(std::size_t ownQueueIndex);
+
+        void
+        RunWorker(std::size_t index);
+};
+
+namespace
+{
+
+//'' pool state and queue index of current thread if it is a worker.
+thread_local const void* tCurrentPoolState = nullptr;
+thread_local std::size_t tCurrentQueueIndex = 0;
+
+bool
+PopBack(WorkerQueue &queue, std::function<void()> &task)
+{
+    std::lock_guard<std::mutex> lock{queue.Mutex};
+    if (queue.Tasks.empty())
+    {
+        return false;
+    }
+    task = std::move(queue.Tasks.back());
+    queue.Tasks.pop_back();
+    return true;
+}
+
+bool
+PopFront(WorkerQueue &queue, std::function<void()> &task)
+{
+    std::lock_guard<std::mutex> lock{queue.Mutex};
+    if (queue.Tasks.empty())
+    {
+        return false;
+    }
+    task = std::move(queue.Tasks.front());
+    queue.Tasks.pop_front();
+    return true;
+}
+
+}
+
+void
+ThreadPool::State::
+Push(std::size_t queueIndex, std::function<void()> task)
+{
+    //'' count before push, so it never drops below zero by pop of other thread.
+    //'' seq_cst pair with RunWorker: either sleeping worker sees pending task or this sees sleeping worker.
+    PendingCount.fetch_add(1);
+    {
+        auto &queue = *Queues[queueIndex];
+        std::lock_guard<std::mutex> lock{queue.Mutex};
+        queue.Tasks.push_back(std::move(task));
+    }
+    if (SleepingCount.load()>0)
+    {
+        std::lock_guard<std::mutex> lock{SleepMutex};
+        SleepCondition.notify_one();
+    }
+}
+
+bool
+ThreadPool::State::
+RunPendingTask(std::size_t ownQueueIndex)
+{
+    if (PendingCount.load()==0)
+    {
+        return false;
+    }
+    std::function<void()> task;
+    auto isFound = ownQueueIndex<Queues.size() && PopBack(*Queues[ownQueueIndex], task);
+    for (std::size_t i = 1; !isFound && i<=Queues.size(); ++i)
+    {
+        isFound = PopFront(*Queues[(ownQueueIndex+i)%Queues.size()], task);
+    }
+    if (!isFound)
+    {
+        return false;
+    }
+    PendingCount.fetch_sub(1);
+    task();
+    return true;
+}
+
+void
+ThreadPool::State::
+RunWorker(std::size_t index)
+{
+    tCurrentPoolState = this;
+    tCurrentQueueIndex = index;
+    while (true)
+    {
+        if (RunPendingTask(index))
+        {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{SleepMutex};
+        SleepingCount.fetch_add(1);
+        //'' timed wait also bounds cost of any missed wakeup.
+        SleepCondition.wait_for(lock, std::chrono::milliseconds{100}, [this]{ return IsStopping || PendingCount.load()>0; });
+        SleepingCount.fetch_sub(1);
+        if (IsStopping && PendingCount.load()==0)
+        {
+            return;
+        }
+    }
+}
+
+ThreadPool::
+ThreadPool(std::size_t threadCount)
+:   mState(std::make_unique<State>())
+{
+    if (threadCount==0)
+    {
+        threadCount = std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+    for (std::size_t i = 0; i<threadCount; ++i)
+    {
+        mState->Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (std::size_t i = 0; i<threadCount; ++i)
+    {
+        mState->Threads.emplace_back([state = mState.get(), i]{ state->RunWorker(i); });
+    }
+}
+
+ThreadPool::
+~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mState->SleepMutex};
+        mState->IsStopping = true;
+    }
+    mState->SleepCondition.notify_all();
+    for (auto &thread : mState->Threads)
+    {
+        thread.join();
+    }
+}
+
+ThreadPool &
+ThreadPool::
+GetGlobal()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+std::size_t
+ThreadPool::
+GetThreadCount()
+const
+{
+    return mState->Threads.size();
+}
+
+void
+ThreadPool::
+Submit(std::function<void()> task)
+{
+    if (tCurrentPoolState==mState.get())
+    {
+        mState->Push(tCurrentQueueIndex, std::move(task));
+        return;
+    }
+    auto queueIndex = mState->NextQueue.fetch_add(1, std::memory_order_relaxed)%mState->Queues.size();
+    mState->Push(queueIndex, std::move(task));
+}
+
+bool
+ThreadPool::
+RunPendingTask()
+{
+    //'' non-worker has no own queue, index of queue count only steals.
+    auto ownQueueIndex = (tCurrentPoolState==mState.get()) ? tCurrentQueueIndex : mState->Queues.size();
+    return mState->RunPendingTask(ownQueueIndex);
+}
+
+void
+ThreadPool::
+RunPendingTasksUntil(const std::function<bool()> &isDone)
+{
+    auto ownQueueIndex = (tCurrentPoolState==mState.get()) ? tCurrentQueueIndex : mState->Queues.size();
+    while (!isDone())
+    {
+        if (mState->RunPendingTask(ownQueueIndex))
+        {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock{mState->SleepMutex};
+        mState->SleepingCount.fetch_add(1);
+        mState->SleepCondition.wait_for(lock, std::chrono::milliseconds{100}, [&]{ return isDone() || mState->PendingCount.load()>0; });
+        mState->SleepingCount.fetch_sub(1);
+    }
+}
+
+void
+ThreadPool::
+NotifyDone()
+{
+    //'' lock pairs with predicate check of sleeping thread, so notify is not missed.
+    std::lock_guard<std::mutex> lock{mState->SleepMutex};
+    mState->SleepCondition.notify_all();
+}
+
+}
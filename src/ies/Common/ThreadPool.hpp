@@ -0,0 +1,80 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <functional>
+#include <memory>
+
+namespace ies
+{
+
+//! @brief Fixed number of worker threads running submitted tasks, with work stealing.
+//! Each worker has its own task deque: task submitted by worker is pushed to its own deque and run LIFO (cache warm),
+//! idle workers steal oldest task (usually largest piece of split work) from other deques.
+//! Task submitted from other thread is distributed to worker deques round-robin.
+//! @note Task must not throw, exception escaping task calls std::terminate. ParallelFor catches and rethrows.
+//! @note Destructor runs all pending tasks then joins workers.
+//! @example
+//!     ThreadPool pool{4};
+//!     std::atomic<int> count{0};
+//!     pool.Submit([&]{ ++count; });
+//!     pool.RunPendingTasksUntil([&]{ return count>0; }); //'' help instead of blocking.
+class IES_EXPORT ThreadPool
+{
+public:
+    //! @brief Start [threadCount] workers, 0 means std::thread::hardware_concurrency().
+        explicit ThreadPool(std::size_t threadCount=0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &
+        operator=(const ThreadPool &) = delete;
+
+    //! @brief Process-wide pool with hardware_concurrency() workers, default pool of ParallelFor.
+        static
+        ThreadPool &
+        GetGlobal();
+
+        std::size_t
+        GetThreadCount()
+        const;
+
+        void
+        Submit(std::function<void()> task);
+
+    //! @brief Run one pending task in calling thread: from own deque if caller is worker of this pool, otherwise steal.
+    //! Used by thread waiting for tasks to finish, so waiting worker keeps working instead of blocking pool.
+    //! @return false if no task is pending.
+        bool
+        RunPendingTask();
+
+    //! @brief Run pending tasks in calling thread until [isDone] returns true, sleep while no task is pending.
+    //! Thread making isDone true must call NotifyDone() after it, to wake sleeping caller.
+        void
+        RunPendingTasksUntil(const std::function<bool()> &isDone);
+
+    //! @brief Wake threads sleeping in RunPendingTasksUntil() to check isDone again.
+        void
+        NotifyDone();
+
+private:
+    struct State;
+    std::unique_ptr<State> mState;
+};
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,112 @@
+#include "ies/Common/ThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace ies
+{
+
+TEST(ThreadPool, Submit)
+{
+    std::atomic<int> count{0};
+    {
+        ThreadPool pool{3};
+        EXPECT_EQ(3u, pool.GetThreadCount());
+        for (int i = 0; i<1000; ++i)
+        {
+            pool.Submit([&]{ ++count; });
+        }
+    }
+    //'' destructor runs all pending tasks.
+    ASSERT_EQ(1000, count.load());
+}
+
+TEST(ThreadPool, SubmitFromTask)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+    for (int i = 0; i<10; ++i)
+    {
+        pool.Submit([&]
+        {
+            for (int j = 0; j<10; ++j)
+            {
+                pool.Submit([&]{ ++count; });
+            }
+        });
+    }
+    while (count.load()<100)
+    {
+        if (!pool.RunPendingTask())
+        {
+            std::this_thread::yield();
+        }
+    }
+    ASSERT_EQ(100, count.load());
+}
+
+TEST(ThreadPool, RunPendingTask)
+{
+    ThreadPool pool{1};
+    std::atomic<bool> isStarted{false};
+    std::atomic<bool> isBlocked{true};
+    std::atomic<int> count{0};
+    //'' only worker is blocked, so other tasks can only be run by calling thread.
+    pool.Submit([&]
+    {
+        isStarted = true;
+        while (isBlocked.load()) { std::this_thread::yield(); }
+    });
+    while (!isStarted.load())
+    {
+        std::this_thread::yield();
+    }
+    pool.Submit([&]{ ++count; });
+    pool.Submit([&]{ ++count; });
+
+    EXPECT_TRUE(pool.RunPendingTask());
+    EXPECT_TRUE(pool.RunPendingTask());
+    EXPECT_FALSE(pool.RunPendingTask());
+    isBlocked = false;
+    ASSERT_EQ(2, count.load());
+}
+
+TEST(ThreadPool, RunPendingTasksUntil)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+    for (int i = 0; i<100; ++i)
+    {
+        pool.Submit([&]
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds{100});
+            if (++count==100)
+            {
+                pool.NotifyDone();
+            }
+        });
+    }
+    pool.RunPendingTasksUntil([&]{ return count.load()==100; });
+    EXPECT_EQ(100, count.load());
+
+    //'' nothing pending: caller sleeps until task of worker notifies.
+    std::atomic<bool> isDone{false};
+    pool.Submit([&]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        isDone = true;
+        pool.NotifyDone();
+    });
+    pool.RunPendingTasksUntil([&]{ return isDone.load(); });
+    ASSERT_TRUE(isDone.load());
+}
+
+TEST(ThreadPool, GetGlobal)
+{
+    ASSERT_EQ(&ThreadPool::GetGlobal(), &ThreadPool::GetGlobal());
+}
+
+}
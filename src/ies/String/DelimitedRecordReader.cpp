@@ -0,0 +1,331 @@
+#include "ies/String/DelimitedRecordReader.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <bit>
+#include <stdexcept>
+
+#include "ies/Common/Simd.hpp"
+
+#if IES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+constexpr std::size_t BlockSize = 64;
+
+//! @brief Bitmask of characters in a 64 bytes block, bit i is set if block[i] is the character.
+struct BlockMasks
+{
+    std::uint64_t Quote;
+    std::uint64_t Delimiter;
+    std::uint64_t LineFeed;
+};
+
+#if IES_SIMD_SSE2
+std::uint64_t
+ToBitMask(__m128i chunk, __m128i character, int shift)
+{
+    auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, character)));
+    return static_cast<std::uint64_t>(bits)<<shift;
+}
+#endif
+
+//! @brief Find masks of structural characters in [block], which must have BlockSize readable bytes.
+BlockMasks
+FindFullBlockMasks(const char* block, const ies::DelimitedFormat &format)
+{
+    BlockMasks masks{0, 0, 0};
+#if IES_SIMD_SSE2
+    auto quote = _mm_set1_epi8(format.Quote);
+    auto delimiter = _mm_set1_epi8(format.Delimiter);
+    auto lineFeed = _mm_set1_epi8('\n');
+    for (int shift = 0; shift<static_cast<int>(BlockSize); shift += 16)
+    {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block+shift));
+        masks.Quote |= ToBitMask(chunk, quote, shift);
+        masks.Delimiter |= ToBitMask(chunk, delimiter, shift);
+        masks.LineFeed |= ToBitMask(chunk, lineFeed, shift);
+    }
+#else
+    for (std::size_t i = 0; i<BlockSize; ++i)
+    {
+        auto bit = std::uint64_t{1}<<i;
+        masks.Quote |= (block[i]==format.Quote) ? bit : 0;
+        masks.Delimiter |= (block[i]==format.Delimiter) ? bit : 0;
+        masks.LineFeed |= (block[i]=='\n') ? bit : 0;
+    }
+#endif
+    return masks;
+}
+
+//! @brief Find masks of structural characters of [remainSize] bytes from [block], bits after remain are cleared.
+BlockMasks
+FindBlockMasks(const char* block, std::size_t remainSize, const ies::DelimitedFormat &format)
+{
+    if (remainSize>=BlockSize)
+    {
+        return FindFullBlockMasks(block, format);
+    }
+
+    char paddedBlock[BlockSize]{};
+    std::memcpy(paddedBlock, block, remainSize);
+    auto masks = FindFullBlockMasks(paddedBlock, format);
+    auto validMask = (std::uint64_t{1}<<remainSize)-1;
+    masks.Quote &= validMask;
+    masks.Delimiter &= validMask;
+    masks.LineFeed &= validMask;
+    return masks;
+}
+
+//! @brief Bit i of result is XOR of bits [0, i] of [bits].
+//! For quote bits, result marks quoted region from opening quote (inclusive) to closing quote (exclusive).
+std::uint64_t
+PrefixXor(std::uint64_t bits)
+{
+    bits ^= bits<<1;
+    bits ^= bits<<2;
+    bits ^= bits<<4;
+    bits ^= bits<<8;
+    bits ^= bits<<16;
+    bits ^= bits<<32;
+    return bits;
+}
+
+}
+
+namespace ies
+{
+
+std::size_t
+DelimitedRecordBatch::
+GetRecordCount()
+const
+{
+    if (mRecordBegins.empty())
+    {
+        return 0;
+    }
+    return mRecordBegins.size()-1;
+}
+
+std::size_t
+DelimitedRecordBatch::
+GetFieldCount(std::size_t record)
+const
+{
+    return mRecordBegins[record+1]-mRecordBegins[record];
+}
+
+std::string_view
+DelimitedRecordBatch::
+GetField(std::size_t record, std::size_t column)
+const
+{
+    return mFields[mRecordBegins[record]+column];
+}
+
+const std::vector<std::string_view> &
+DelimitedRecordBatch::
+GetFields()
+const
+{
+    return mFields;
+}
+
+const std::vector<std::size_t> &
+DelimitedRecordBatch::
+GetRecordBegins()
+const
+{
+    return mRecordBegins;
+}
+
+void
+DelimitedRecordBatch::
+GetColumn(std::size_t column, std::vector<std::string_view> &columnFields)
+const
+{
+    auto recordCount = GetRecordCount();
+    columnFields.clear();
+    columnFields.reserve(recordCount);
+    for (std::size_t record = 0; record<recordCount; ++record)
+    {
+        if (column<GetFieldCount(record))
+        {
+            columnFields.emplace_back(GetField(record, column));
+        }
+        else
+        {
+            columnFields.emplace_back();
+        }
+    }
+}
+
+void
+DelimitedRecordBatch::
+Clear()
+{
+    mFields.clear();
+    mRecordBegins.clear();
+    mUnescapedBuffer.clear();
+    mUnescapedFields.clear();
+}
+
+DelimitedRecordReader::
+DelimitedRecordReader(std::string_view input, DelimitedFormat format)
+:   mInput(input),
+    mFormat(format)
+{
+    if (mFormat.Delimiter==mFormat.Quote || mFormat.Delimiter=='\n' || mFormat.Quote=='\n')
+    {
+        throw std::runtime_error("DelimitedRecordReader: delimiter, quote and line feed must be different.");
+    }
+}
+
+bool
+DelimitedRecordReader::
+ReadBatch(DelimitedRecordBatch &batch, std::size_t maxRecordCount)
+{
+    batch.Clear();
+    if (IsEnd() || maxRecordCount==0)
+    {
+        return false;
+    }
+
+    auto bindUnescapedFields = [&batch]()
+    {
+        for (auto &unescaped : batch.mUnescapedFields)
+        {
+            batch.mFields[unescaped.FieldIndex] = std::string_view{batch.mUnescapedBuffer.data()+unescaped.Offset, unescaped.Size};
+        }
+    };
+
+    const auto* input = mInput.data();
+    auto inputSize = mInput.size();
+    std::size_t recordCount = 0;
+    auto fieldBegin = mOffset;
+    batch.mRecordBegins.emplace_back(0);
+
+    //'' all ones if previous block ends inside quoted region.
+    std::uint64_t inQuote = 0;
+    for (auto blockBegin = mOffset; blockBegin<inputSize; blockBegin += BlockSize)
+    {
+        auto masks = FindBlockMasks(input+blockBegin, inputSize-blockBegin, mFormat);
+        auto quotedRegion = PrefixXor(masks.Quote)^inQuote;
+        inQuote = std::uint64_t{0}-(quotedRegion>>63);
+
+        auto structural = (masks.Delimiter|masks.LineFeed)&~quotedRegion;
+        while (structural!=0)
+        {
+            auto bit = std::countr_zero(structural);
+            structural &= structural-1;
+
+            auto pos = blockBegin+static_cast<std::size_t>(bit);
+            auto isLineFeed = ((masks.LineFeed>>bit)&1)!=0;
+            auto fieldEnd = pos;
+            if (isLineFeed && fieldEnd>fieldBegin && input[fieldEnd-1]=='\r')
+            {
+                --fieldEnd;
+            }
+            AddField(batch, fieldBegin, fieldEnd);
+            fieldBegin = pos+1;
+
+            if (isLineFeed)
+            {
+                batch.mRecordBegins.emplace_back(batch.mFields.size());
+                ++recordCount;
+                if (recordCount==maxRecordCount)
+                {
+                    mOffset = fieldBegin;
+                    bindUnescapedFields();
+                    return true;
+                }
+            }
+        }
+    }
+
+    if (inQuote!=0)
+    {
+        throw std::runtime_error("DelimitedRecordReader: unterminated quoted field begins before offset ["+std::to_string(inputSize)+"].");
+    }
+
+    //'' last record without line break.
+    if (fieldBegin<inputSize || batch.mFields.size()>batch.mRecordBegins.back())
+    {
+        AddField(batch, fieldBegin, inputSize);
+        batch.mRecordBegins.emplace_back(batch.mFields.size());
+        ++recordCount;
+    }
+
+    mOffset = inputSize;
+    bindUnescapedFields();
+    return recordCount>0;
+}
+
+bool
+DelimitedRecordReader::
+IsEnd()
+const
+{
+    return mOffset>=mInput.size();
+}
+
+std::size_t
+DelimitedRecordReader::
+GetOffset()
+const
+{
+    return mOffset;
+}
+
+void
+DelimitedRecordReader::
+AddField(DelimitedRecordBatch &batch, std::size_t fieldBegin, std::size_t fieldEnd)
+const
+{
+    auto field = mInput.substr(fieldBegin, fieldEnd-fieldBegin);
+    if (field.empty() || field.front()!=mFormat.Quote)
+    {
+        batch.mFields.emplace_back(field);
+        return;
+    }
+
+    auto throwMalformed = [fieldBegin]()
+    {
+        throw std::runtime_error("DelimitedRecordReader: malformed quoted field at offset ["+std::to_string(fieldBegin)+"].");
+    };
+
+    if (field.size()<2 || field.back()!=mFormat.Quote)
+    {
+        throwMalformed();
+    }
+
+    auto content = field.substr(1, field.size()-2);
+    if (content.find(mFormat.Quote)==std::string_view::npos)
+    {
+        batch.mFields.emplace_back(content);
+        return;
+    }
+
+    auto offset = batch.mUnescapedBuffer.size();
+    for (std::size_t i = 0; i<content.size(); ++i)
+    {
+        batch.mUnescapedBuffer.push_back(content[i]);
+        if (content[i]==mFormat.Quote)
+        {
+            if (i+1>=content.size() || content[i+1]!=mFormat.Quote)
+            {
+                throwMalformed();
+            }
+            ++i;
+        }
+    }
+    batch.mUnescapedFields.push_back({batch.mFields.size(), offset, batch.mUnescapedBuffer.size()-offset});
+    batch.mFields.emplace_back();
+}
+
+}
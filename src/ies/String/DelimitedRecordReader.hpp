@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ies
+{
+
+//! @brief Dialect of delimited records, default is RFC 4180 CSV.
+//! For TSV use DelimitedFormat{'\t'}.
+struct DelimitedFormat
+{
+    char Delimiter{','};
+    char Quote{'"'};
+};
+
+//! @brief A batch of records read by DelimitedRecordReader.
+//! Fields of all records are stored flat in record order, so iterating a column over a batch is cache friendly.
+//! @note Fields are string_view into reader's input, except quoted fields with escaped quote ("" => ")
+//! which are unescaped into buffer owned by batch. So fields are valid until batch is cleared or read again,
+//! and input of reader is still alive.
+class IES_EXPORT DelimitedRecordBatch
+{
+public:
+        std::size_t
+        GetRecordCount()
+        const;
+
+    //! @brief Get field count of [record]. Records can have different field count.
+        std::size_t
+        GetFieldCount(std::size_t record)
+        const;
+
+    //! @brief Get field of [record] at [column], no bounds check.
+        std::string_view
+        GetField(std::size_t record, std::size_t column)
+        const;
+
+    //! @brief Get all fields in batch flattened by record order.
+    //! Fields of record i are in [GetRecordBegins()[i], GetRecordBegins()[i+1]).
+        const std::vector<std::string_view> &
+        GetFields()
+        const;
+
+    //! @brief Get begin index in GetFields() of each record, with extra end index. (size = GetRecordCount()+1)
+        const std::vector<std::size_t> &
+        GetRecordBegins()
+        const;
+
+    //! @brief Collect fields at [column] of every record in batch into [columnFields] (cleared first).
+    //! Record without such column gives empty field.
+        void
+        GetColumn(std::size_t column, std::vector<std::string_view> &columnFields)
+        const;
+
+        void
+        Clear();
+
+private:
+    std::vector<std::string_view> mFields;
+    std::vector<std::size_t> mRecordBegins;
+    std::string mUnescapedBuffer;
+
+    //'' Field unescaped into mUnescapedBuffer, view is bound after batch is parsed since buffer may grow.
+    struct UnescapedField
+    {
+        std::size_t FieldIndex;
+        std::size_t Offset;
+        std::size_t Size;
+    };
+    std::vector<UnescapedField> mUnescapedFields;
+
+    friend class DelimitedRecordReader;
+};
+
+//! @brief High throughput RFC 4180 delimited record (CSV/TSV) reader over an in-memory input.
+//! - Field can be quoted to contain delimiter, line break, or escaped quote ("").
+//! - Record ends with LF or CRLF, last record can omit line break.
+//! - Empty line is a record of one empty field.
+//! Structural characters are found 64 bytes per step by bitmasks (SIMD when available),
+//! quoted regions are masked out by prefix XOR of quote bits, so cost is nearly independent of field count.
+//! @note Quote is only treated as quoting at begin of field, stray quote in middle of unquoted field is not supported.
+//! @example
+//!     DelimitedRecordReader reader{input};
+//!     DelimitedRecordBatch batch;
+//!     std::vector<std::string_view> column;
+//!     while (reader.ReadBatch(batch))
+//!     {
+//!         batch.GetColumn(2, column);
+//!         Process(column);
+//!     }
+class IES_EXPORT DelimitedRecordReader
+{
+public:
+    //! @note [input] must outlive reader and batches read from it.
+        explicit DelimitedRecordReader(std::string_view input, DelimitedFormat format={});
+
+    //! @brief Read next at most [maxRecordCount] records into [batch] (cleared first).
+    //! @return false if no more record to read.
+    //! @throw std::runtime_error if quoted field is not terminated or has characters after closing quote.
+        bool
+        ReadBatch(DelimitedRecordBatch &batch, std::size_t maxRecordCount=1024);
+
+        bool
+        IsEnd()
+        const;
+
+    //! @brief Get current offset in input, begin of next record to read.
+        std::size_t
+        GetOffset()
+        const;
+
+private:
+    std::string_view mInput;
+    DelimitedFormat mFormat;
+    std::size_t mOffset{0};
+
+        void
+        AddField(DelimitedRecordBatch &batch, std::size_t fieldBegin, std::size_t fieldEnd)
+        const;
+};
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,152 @@
+#include "ies/String/DelimitedRecordReader.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+std::vector<std::vector<std::string>>
+ReadAllRecords(std::string_view input, DelimitedFormat format={}, std::size_t maxRecordCount=1024)
+{
+    std::vector<std::vector<std::string>> records;
+    DelimitedRecordReader reader{input, format};
+    DelimitedRecordBatch batch;
+    while (reader.ReadBatch(batch, maxRecordCount))
+    {
+        for (std::size_t record = 0; record<batch.GetRecordCount(); ++record)
+        {
+            auto &fields = records.emplace_back();
+            for (std::size_t column = 0; column<batch.GetFieldCount(record); ++column)
+            {
+                fields.emplace_back(batch.GetField(record, column));
+            }
+        }
+    }
+    return records;
+}
+
+}
+
+TEST(DelimitedRecordReader, Empty)
+{
+    DelimitedRecordReader reader{""};
+    DelimitedRecordBatch batch;
+    EXPECT_TRUE(reader.IsEnd());
+    EXPECT_FALSE(reader.ReadBatch(batch));
+    ASSERT_EQ(0u, batch.GetRecordCount());
+}
+
+TEST(DelimitedRecordReader, SameAsSplitPreserve)
+{
+    std::vector<std::vector<std::string>> expectRecords
+    {
+        {"", "", "b", "", "", "e", "", ""},
+        {"a", "b"},
+        {""},
+        {"c"},
+    };
+    EXPECT_EQ(expectRecords, ReadAllRecords(",,b,,,e,,\na,b\n\nc\n"));
+    ASSERT_EQ(expectRecords, ReadAllRecords(",,b,,,e,,\r\na,b\r\n\r\nc"));
+}
+
+TEST(DelimitedRecordReader, QuotedField)
+{
+    std::string input =
+        "id,text,note\n"
+        "1,\"a, b\",\"line1\nline2\"\n"
+        "2,\"say \"\"hi\"\"\",\"\"\n"
+        "3,\"\"\"\",plain\n";
+
+    std::vector<std::vector<std::string>> expectRecords
+    {
+        {"id", "text", "note"},
+        {"1", "a, b", "line1\nline2"},
+        {"2", "say \"hi\"", ""},
+        {"3", "\"", "plain"},
+    };
+    ASSERT_EQ(expectRecords, ReadAllRecords(input));
+}
+
+TEST(DelimitedRecordReader, FieldViewsInput)
+{
+    std::string input = "abc,\"quoted\",\"esc\"\"aped\"";
+    DelimitedRecordReader reader{input};
+    DelimitedRecordBatch batch;
+    ASSERT_TRUE(reader.ReadBatch(batch));
+    ASSERT_EQ(1u, batch.GetRecordCount());
+    ASSERT_EQ(3u, batch.GetFieldCount(0));
+
+    EXPECT_EQ(input.data(), batch.GetField(0, 0).data());
+    EXPECT_EQ(input.data()+5, batch.GetField(0, 1).data());
+    EXPECT_EQ("quoted", batch.GetField(0, 1));
+    ASSERT_EQ("esc\"aped", batch.GetField(0, 2));
+}
+
+TEST(DelimitedRecordReader, Tsv)
+{
+    std::vector<std::vector<std::string>> expectRecords
+    {
+        {"a", "b,c", "d\te"},
+        {"f"},
+    };
+    ASSERT_EQ(expectRecords, ReadAllRecords("a\tb,c\t\"d\te\"\nf\n", DelimitedFormat{'\t'}));
+}
+
+TEST(DelimitedRecordReader, LongRecordsAcrossBlocks)
+{
+    std::string input;
+    std::vector<std::vector<std::string>> expectRecords;
+    for (int i = 0; i<200; ++i)
+    {
+        auto number = std::to_string(i);
+        auto text = std::string(static_cast<std::size_t>(i%70), 'x')+",\n\""+number;
+        input += number+",\""+std::string(static_cast<std::size_t>(i%70), 'x')+",\n\"\""+number+"\","+number+"\n";
+        expectRecords.push_back({number, text, number});
+    }
+
+    EXPECT_EQ(expectRecords, ReadAllRecords(input));
+    ASSERT_EQ(expectRecords, ReadAllRecords(input, {}, 7));
+}
+
+TEST(DelimitedRecordReader, Batch)
+{
+    DelimitedRecordReader reader{"a,1\nb,2\nc\nd,4\n"};
+    DelimitedRecordBatch batch;
+    std::vector<std::string_view> column;
+
+    ASSERT_TRUE(reader.ReadBatch(batch, 3));
+    EXPECT_EQ(3u, batch.GetRecordCount());
+    EXPECT_EQ(5u, batch.GetFields().size());
+    batch.GetColumn(1, column);
+    EXPECT_EQ((std::vector<std::string_view>{"1", "2", ""}), column);
+    EXPECT_FALSE(reader.IsEnd());
+
+    ASSERT_TRUE(reader.ReadBatch(batch, 3));
+    EXPECT_EQ(1u, batch.GetRecordCount());
+    batch.GetColumn(0, column);
+    EXPECT_EQ((std::vector<std::string_view>{"d"}), column);
+    EXPECT_TRUE(reader.IsEnd());
+
+    ASSERT_FALSE(reader.ReadBatch(batch, 3));
+}
+
+TEST(DelimitedRecordReader, Malformed)
+{
+    EXPECT_ANY_THROW(
+        ReadAllRecords("a,\"unterminated\nb,c\n");
+    );
+    EXPECT_ANY_THROW(
+        ReadAllRecords("a,\"quoted\"tail,b\n");
+    );
+    ASSERT_ANY_THROW(
+        DelimitedRecordReader(",", DelimitedFormat{',', ','});
+    );
+}
+
+}
@@ -0,0 +1,469 @@
+#include "ies/String/FuzzyIndex.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <queue>
+#include <stdexcept>
+#include <tuple>
+
+namespace
+{
+
+constexpr char FileMagic[8] = {'I', 'E', 'S', 'F', 'Z', 'I', 'D', 'X'};
+constexpr std::uint32_t FileVersion = 1;
+
+void
+WriteUint(std::ostream &stream, std::uint64_t value, std::size_t byteCount)
+{
+    char bytes[8];
+    for (std::size_t i = 0; i<byteCount; ++i)
+    {
+        bytes[i] = static_cast<char>((value>>(8*i))&0xFF);
+    }
+    stream.write(bytes, static_cast<std::streamsize>(byteCount));
+}
+
+std::uint64_t
+ReadUint(std::istream &stream, std::size_t byteCount)
+{
+    char bytes[8];
+    if (!stream.read(bytes, static_cast<std::streamsize>(byteCount)))
+    {
+        throw std::runtime_error("FuzzyIndex::Load: unexpected end of stream.");
+    }
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i<byteCount; ++i)
+    {
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i]))<<(8*i);
+    }
+    return value;
+}
+
+void
+WriteUint32Vector(std::ostream &stream, const std::vector<std::uint32_t> &values)
+{
+    WriteUint(stream, values.size(), 8);
+    for (auto value : values)
+    {
+        WriteUint(stream, value, 4);
+    }
+}
+
+std::vector<std::uint32_t>
+ReadUint32Vector(std::istream &stream)
+{
+    auto size = ReadUint(stream, 8);
+    std::vector<std::uint32_t> values;
+    //'' not reserve by untrusted size, vector grows as data is actually read.
+    for (std::uint64_t i = 0; i<size; ++i)
+    {
+        values.emplace_back(static_cast<std::uint32_t>(ReadUint(stream, 4)));
+    }
+    return values;
+}
+
+std::string
+ReadBytes(std::istream &stream, std::uint64_t size)
+{
+    std::string bytes;
+    constexpr std::uint64_t ChunkSize = 1<<16;
+    while (bytes.size()<size)
+    {
+        auto chunk = std::min(ChunkSize, size-bytes.size());
+        auto offset = bytes.size();
+        bytes.resize(offset+chunk);
+        if (!stream.read(bytes.data()+offset, static_cast<std::streamsize>(chunk)))
+        {
+            throw std::runtime_error("FuzzyIndex::Load: unexpected end of stream.");
+        }
+    }
+    return bytes;
+}
+
+//! @brief Check [depths] and [subtreeEnds] form a preorder trie, so Search and FindTopK walk in bounds and terminate.
+//! Root has depth 0 and covers all nodes, every other node is inside its parent's subtree,
+//! with depth of parent + 1 and non-empty subtree.
+bool
+IsValidTrie(const std::vector<std::uint32_t> &depths, const std::vector<std::uint32_t> &subtreeEnds)
+{
+    auto nodeCount = depths.size();
+    if (nodeCount==0 || subtreeEnds.size()!=nodeCount || depths[0]!=0 || subtreeEnds[0]!=nodeCount)
+    {
+        return false;
+    }
+    //'' ancestors[i] is open ancestor of current node at depth i.
+    std::vector<std::size_t> ancestors{0};
+    for (std::size_t node = 1; node<nodeCount; ++node)
+    {
+        while (subtreeEnds[ancestors.back()]<=node)
+        {
+            ancestors.pop_back();
+        }
+        auto parent = ancestors.back();
+        if (depths[node]!=depths[parent]+1 || subtreeEnds[node]<=node || subtreeEnds[node]>subtreeEnds[parent])
+        {
+            return false;
+        }
+        ancestors.emplace_back(node);
+    }
+    return true;
+}
+
+}
+
+namespace ies
+{
+
+FuzzyIndex::
+FuzzyIndex(std::vector<std::string> words)
+:   mWords(std::move(words))
+{
+    if (mWords.size()>std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::runtime_error("FuzzyIndex: too many words.");
+    }
+
+    std::vector<std::uint32_t> sortedIds(mWords.size());
+    std::iota(sortedIds.begin(), sortedIds.end(), 0);
+    std::stable_sort(sortedIds.begin(), sortedIds.end(), [this](std::uint32_t lhs, std::uint32_t rhs)
+    {
+        return mWords[lhs]<mWords[rhs];
+    });
+
+    auto addNode = [this](char label, std::size_t depth)
+    {
+        if (mLabels.size()>=std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error("FuzzyIndex: too many trie nodes.");
+        }
+        mLabels.emplace_back(label);
+        mDepths.emplace_back(static_cast<std::uint32_t>(depth));
+        mSubtreeEnds.emplace_back(0);
+        mWordBegins.emplace_back(static_cast<std::uint32_t>(mWordIds.size()));
+        mMaxDepth = std::max(mMaxDepth, depth);
+    };
+
+    //'' path[d] is node of current word's prefix of size d.
+    std::vector<std::uint32_t> path{0};
+    addNode('\0', 0);
+    std::string_view previousWord;
+    for (auto id : sortedIds)
+    {
+        std::string_view word = mWords[id];
+        auto [mismatch, previousMismatch] = std::mismatch(word.begin(), word.end(), previousWord.begin(), previousWord.end());
+        auto commonSize = static_cast<std::size_t>(mismatch-word.begin());
+        while (path.size()>commonSize+1)
+        {
+            mSubtreeEnds[path.back()] = static_cast<std::uint32_t>(mLabels.size());
+            path.pop_back();
+        }
+        for (auto depth = commonSize+1; depth<=word.size(); ++depth)
+        {
+            path.emplace_back(static_cast<std::uint32_t>(mLabels.size()));
+            addNode(word[depth-1], depth);
+        }
+        mWordIds.emplace_back(id);
+        previousWord = word;
+    }
+    for (auto node : path)
+    {
+        mSubtreeEnds[node] = static_cast<std::uint32_t>(mLabels.size());
+    }
+    mWordBegins.emplace_back(static_cast<std::uint32_t>(mWordIds.size()));
+}
+
+template <typename GetThreshold, typename OnMatch>
+void
+FuzzyIndex::
+Search(std::string_view query, GetThreshold getThreshold, OnMatch onMatch)
+const
+{
+    if (mLabels.empty())
+    {
+        return;
+    }
+
+    //'' rows[d] is DP row of query against trie prefix of depth d, rowMins[d] is its minimum.
+    //'' only cells within threshold of diagonal are computed (Ukkonen's cutoff), other cells exceed threshold,
+    //'' cells next to band are set to Exceeded so next row reads them as boundary.
+    constexpr auto Exceeded = std::numeric_limits<std::size_t>::max()/2;
+    auto querySize = query.size();
+    auto rowSize = querySize+1;
+    std::vector<std::size_t> rows((mMaxDepth+1)*rowSize, Exceeded);
+    std::vector<std::size_t> rowMins(mMaxDepth+1, 0);
+    std::vector<char> prefix(mMaxDepth+1, '\0');
+    std::iota(rows.begin(), rows.begin()+static_cast<std::ptrdiff_t>(rowSize), std::size_t{0});
+
+    auto reportWords = [&](std::size_t node, std::size_t distance)
+    {
+        if (distance>getThreshold())
+        {
+            return;
+        }
+        for (auto i = mWordBegins[node]; i<mWordBegins[node+1]; ++i)
+        {
+            //'' threshold may shrink after each reported word.
+            if (distance<=getThreshold())
+            {
+                onMatch(mWordIds[i], distance);
+            }
+        }
+    };
+    reportWords(0, querySize);
+
+    std::size_t node = 1;
+    auto nodeCount = mLabels.size();
+    while (node<nodeCount)
+    {
+        std::size_t depth = mDepths[node];
+        auto c = mLabels[node];
+        prefix[depth] = c;
+
+        //'' threshold never grows, so band is inside parent's band plus its boundary.
+        auto threshold = getThreshold();
+        auto jBegin = (depth>threshold) ? depth-threshold : 0;
+        auto jEnd = (threshold>=querySize) ? querySize : std::min(querySize, depth+threshold);
+
+        auto* row = rows.data()+depth*rowSize;
+        const auto* previous = row-rowSize;
+        const auto* previous2 = (depth>=2) ? previous-rowSize : nullptr;
+        auto rowMin = Exceeded;
+        if (jBegin==0)
+        {
+            row[0] = depth;
+            rowMin = depth;
+            jBegin = 1;
+        }
+        else
+        {
+            row[jBegin-1] = Exceeded;
+        }
+        for (auto j = jBegin; j<=jEnd; ++j)
+        {
+            auto cost = (c==query[j-1]) ? 0u : 1u;
+            auto distance = std::min({previous[j]+1, row[j-1]+1, previous[j-1]+cost});
+            if (previous2 && j>1 && c==query[j-2] && prefix[depth-1]==query[j-1])
+            {
+                distance = std::min(distance, previous2[j-2]+1);
+            }
+            row[j] = std::min(distance, Exceeded);
+            rowMin = std::min(rowMin, distance);
+        }
+        if (jEnd<querySize)
+        {
+            row[jEnd+1] = Exceeded;
+        }
+        rowMins[depth] = rowMin;
+
+        if (jEnd==querySize && mWordBegins[node]!=mWordBegins[node+1])
+        {
+            reportWords(node, row[querySize]);
+        }
+
+        //'' descendants only derive from this row and parent row, parent row only by transposition (+1).
+        threshold = getThreshold();
+        if (rowMin>threshold && rowMins[depth-1]>=threshold)
+        {
+            node = mSubtreeEnds[node];
+        }
+        else
+        {
+            ++node;
+        }
+    }
+}
+
+std::vector<FuzzyMatch>
+FuzzyIndex::
+FindWithin(std::string_view query, std::size_t maxDistance)
+const
+{
+    std::vector<FuzzyMatch> matches;
+    Search(query,
+        [maxDistance]() { return maxDistance; },
+        [&matches](std::uint32_t id, std::size_t distance) { matches.push_back({id, distance}); });
+
+    std::sort(matches.begin(), matches.end(), [](const FuzzyMatch &lhs, const FuzzyMatch &rhs)
+    {
+        return std::tie(lhs.Distance, lhs.Index)<std::tie(rhs.Distance, rhs.Index);
+    });
+    return matches;
+}
+
+std::vector<FuzzyMatch>
+FuzzyIndex::
+FindTopK(std::string_view query, std::size_t k, std::size_t maxDistance)
+const
+{
+    auto isCloser = [](const FuzzyMatch &lhs, const FuzzyMatch &rhs)
+    {
+        return std::tie(lhs.Distance, lhs.Index)<std::tie(rhs.Distance, rhs.Index);
+    };
+
+    if (k==0)
+    {
+        return {};
+    }
+
+    //'' max heap of k closest matches, top is farthest.
+    //'' search with small threshold first and increase it until k matches are found (iterative deepening),
+    //'' since large threshold visits most of trie.
+    //'' all words are within distance max(query size, max word size).
+    std::priority_queue<FuzzyMatch, std::vector<FuzzyMatch>, decltype(isCloser)> heap{isCloser};
+    auto maxThreshold = std::min(maxDistance, std::max(query.size(), mMaxDepth));
+    for (std::size_t searchThreshold = 0; searchThreshold<=maxThreshold; ++searchThreshold)
+    {
+        heap = decltype(heap){isCloser};
+        Search(query,
+            [&]()
+            {
+                return (heap.size()<k) ? searchThreshold : std::min(searchThreshold, heap.top().Distance);
+            },
+            [&](std::uint32_t id, std::size_t distance)
+            {
+                FuzzyMatch match{id, distance};
+                if (heap.size()<k)
+                {
+                    heap.push(match);
+                }
+                else if (isCloser(match, heap.top()))
+                {
+                    heap.pop();
+                    heap.push(match);
+                }
+            });
+        if (heap.size()==k)
+        {
+            break;
+        }
+    }
+
+    std::vector<FuzzyMatch> matches;
+    matches.reserve(heap.size());
+    while (!heap.empty())
+    {
+        matches.emplace_back(heap.top());
+        heap.pop();
+    }
+    std::reverse(matches.begin(), matches.end());
+    return matches;
+}
+
+const std::vector<std::string> &
+FuzzyIndex::
+GetWords()
+const
+{
+    return mWords;
+}
+
+std::size_t
+FuzzyIndex::
+GetNodeCount()
+const
+{
+    return mLabels.size();
+}
+
+void
+FuzzyIndex::
+Save(std::ostream &stream)
+const
+{
+    stream.write(FileMagic, sizeof(FileMagic));
+    WriteUint(stream, FileVersion, 4);
+
+    WriteUint(stream, mWords.size(), 8);
+    for (auto &word : mWords)
+    {
+        WriteUint(stream, word.size(), 8);
+        stream.write(word.data(), static_cast<std::streamsize>(word.size()));
+    }
+
+    WriteUint(stream, mLabels.size(), 8);
+    stream.write(mLabels.data(), static_cast<std::streamsize>(mLabels.size()));
+    WriteUint32Vector(stream, mDepths);
+    WriteUint32Vector(stream, mSubtreeEnds);
+    WriteUint32Vector(stream, mWordBegins);
+    WriteUint32Vector(stream, mWordIds);
+}
+
+void
+FuzzyIndex::
+Save(const std::string &filePath)
+const
+{
+    std::ofstream file{filePath, std::ios::binary};
+    if (!file)
+    {
+        throw std::runtime_error("FuzzyIndex::Save: cannot open file ["+filePath+"].");
+    }
+    Save(file);
+    if (!file.flush())
+    {
+        throw std::runtime_error("FuzzyIndex::Save: cannot write file ["+filePath+"].");
+    }
+}
+
+FuzzyIndex
+FuzzyIndex::
+Load(std::istream &stream)
+{
+    char magic[sizeof(FileMagic)];
+    if (!stream.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(FileMagic)))
+    {
+        throw std::runtime_error("FuzzyIndex::Load: not a FuzzyIndex stream.");
+    }
+    if (auto version = ReadUint(stream, 4); version!=FileVersion)
+    {
+        throw std::runtime_error("FuzzyIndex::Load: unsupported version ["+std::to_string(version)+"].");
+    }
+
+    FuzzyIndex index;
+    auto wordCount = ReadUint(stream, 8);
+    for (std::uint64_t i = 0; i<wordCount; ++i)
+    {
+        index.mWords.emplace_back(ReadBytes(stream, ReadUint(stream, 8)));
+    }
+
+    auto labels = ReadBytes(stream, ReadUint(stream, 8));
+    index.mLabels.assign(labels.begin(), labels.end());
+    index.mDepths = ReadUint32Vector(stream);
+    index.mSubtreeEnds = ReadUint32Vector(stream);
+    index.mWordBegins = ReadUint32Vector(stream);
+    index.mWordIds = ReadUint32Vector(stream);
+
+    auto nodeCount = index.mLabels.size();
+    auto isValid = nodeCount>0
+        && index.mDepths.size()==nodeCount
+        && index.mSubtreeEnds.size()==nodeCount
+        && index.mWordBegins.size()==nodeCount+1
+        && index.mWordBegins.back()==index.mWordIds.size()
+        && std::is_sorted(index.mWordBegins.begin(), index.mWordBegins.end())
+        && IsValidTrie(index.mDepths, index.mSubtreeEnds)
+        && std::all_of(index.mWordIds.begin(), index.mWordIds.end(), [wordCount](std::uint32_t id) { return id<wordCount; });
+    if (!isValid)
+    {
+        throw std::runtime_error("FuzzyIndex::Load: inconsistent index data.");
+    }
+    index.mMaxDepth = *std::max_element(index.mDepths.begin(), index.mDepths.end());
+    return index;
+}
+
+FuzzyIndex
+FuzzyIndex::
+Load(const std::string &filePath)
+{
+    std::ifstream file{filePath, std::ios::binary};
+    if (!file)
+    {
+        throw std::runtime_error("FuzzyIndex::Load: cannot open file ["+filePath+"].");
+    }
+    return Load(file);
+}
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ies
+{
+
+//! @brief Word found by FuzzyIndex, [Index] is index of word in dictionary.
+struct FuzzyMatch
+{
+    std::size_t Index;
+    std::size_t Distance;
+
+    bool operator==(const FuzzyMatch &other) const
+    {
+        return Index==other.Index && Distance==other.Distance;
+    }
+};
+
+//! @brief Index of a dictionary for finding words similar to query by DamerauLevenshtein() distance.
+//! Words are stored in a trie, query runs DP row (band within threshold of diagonal) per trie node so words sharing prefix share rows,
+//! and a subtree is skipped when its last two rows all exceed distance threshold.
+//! @note Distance is same as DamerauLevenshtein() (optimal string alignment). Since it is not a metric,
+//! BK-tree is not used.
+//! @example
+//!     FuzzyIndex index{words};
+//!     index.Save("words.idx");
+//!     auto loaded = FuzzyIndex::Load("words.idx");
+//!     for (auto [index, distance] : loaded.FindWithin("levenstein", 2)) { ... }
+class IES_EXPORT FuzzyIndex
+{
+public:
+        FuzzyIndex() = default;
+
+    //! @brief Build index of [words], duplicated words are allowed.
+    //! @throw std::runtime_error if index has more than 2^32-1 words or trie nodes.
+        explicit FuzzyIndex(std::vector<std::string> words);
+
+    //! @brief Find words with distance to [query] at most [maxDistance].
+    //! @return Matches sorted by distance, then by index.
+        std::vector<FuzzyMatch>
+        FindWithin(std::string_view query, std::size_t maxDistance)
+        const;
+
+    //! @brief Find [k] words nearest to [query], ties are broken by smaller index.
+    //! Can limit distance by [maxDistance] for faster search.
+    //! @return Matches sorted by distance, then by index. Less than k if dictionary is smaller or limited by maxDistance.
+        std::vector<FuzzyMatch>
+        FindTopK(std::string_view query, std::size_t k, std::size_t maxDistance=static_cast<std::size_t>(-1))
+        const;
+
+        const std::vector<std::string> &
+        GetWords()
+        const;
+
+        std::size_t
+        GetNodeCount()
+        const;
+
+    //! @brief Save words and trie to binary [stream] (little endian).
+        void
+        Save(std::ostream &stream)
+        const;
+
+    //! @throw std::runtime_error if file cannot be written.
+        void
+        Save(const std::string &filePath)
+        const;
+
+    //! @throw std::runtime_error if stream is not saved by FuzzyIndex::Save() or is truncated.
+        static
+        FuzzyIndex
+        Load(std::istream &stream);
+
+    //! @throw std::runtime_error if file cannot be read or is not saved by FuzzyIndex::Save().
+        static
+        FuzzyIndex
+        Load(const std::string &filePath);
+
+private:
+    std::vector<std::string> mWords;
+    //'' trie nodes in preorder, node 0 is root (empty prefix).
+    std::vector<char> mLabels;
+    std::vector<std::uint32_t> mDepths;
+    //'' subtree of node n is nodes [n, mSubtreeEnds[n]).
+    std::vector<std::uint32_t> mSubtreeEnds;
+    //'' words ending at node n are mWordIds[mWordBegins[n], mWordBegins[n+1]).
+    std::vector<std::uint32_t> mWordBegins;
+    std::vector<std::uint32_t> mWordIds;
+    std::size_t mMaxDepth{0};
+
+    //! @brief Traverse trie and call [onMatch(wordId, distance)] for words within threshold,
+    //! [getThreshold()] is called to prune subtrees and can shrink during search.
+        template <typename GetThreshold, typename OnMatch>
+        void
+        Search(std::string_view query, GetThreshold getThreshold, OnMatch onMatch)
+        const;
+};
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,171 @@
+#include "ies/String/FuzzyIndex.hpp"
+
+#include "ies/String/Levenshtein.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+std::vector<std::string>
+MakeRandomWords(std::mt19937 &generator, std::size_t wordCount, std::size_t maxSize, int letterCount)
+{
+    std::uniform_int_distribution<std::size_t> sizeDistribution{0, maxSize};
+    std::uniform_int_distribution<int> charDistribution{0, letterCount-1};
+    std::vector<std::string> words;
+    for (std::size_t i = 0; i<wordCount; ++i)
+    {
+        std::string word;
+        auto size = sizeDistribution(generator);
+        for (std::size_t j = 0; j<size; ++j)
+        {
+            word += static_cast<char>('a'+charDistribution(generator));
+        }
+        words.emplace_back(word);
+    }
+    return words;
+}
+
+std::vector<FuzzyMatch>
+FindAllByScan(const std::vector<std::string> &words, const std::string &query)
+{
+    std::vector<FuzzyMatch> matches;
+    for (std::size_t i = 0; i<words.size(); ++i)
+    {
+        matches.push_back({i, DamerauLevenshtein(words[i], query).first});
+    }
+    std::sort(matches.begin(), matches.end(), [](const FuzzyMatch &lhs, const FuzzyMatch &rhs)
+    {
+        return std::tie(lhs.Distance, lhs.Index)<std::tie(rhs.Distance, rhs.Index);
+    });
+    return matches;
+}
+
+}
+
+TEST(FuzzyIndex, Empty)
+{
+    FuzzyIndex index;
+    EXPECT_TRUE(index.FindWithin("abc", 3).empty());
+    EXPECT_TRUE(index.FindTopK("abc", 3).empty());
+    ASSERT_EQ(0u, index.GetNodeCount());
+}
+
+TEST(FuzzyIndex, FindWithin)
+{
+    FuzzyIndex index{{"levenshtein", "lowenstein", "leviathan", "", "levenshtein", "ab"}};
+    EXPECT_EQ(29u, index.GetNodeCount());
+
+    std::vector<FuzzyMatch> expect{{0, 1}, {4, 1}};
+    EXPECT_EQ(expect, index.FindWithin("levenstein", 1));
+    expect = {{0, 1}, {4, 1}, {1, 2}};
+    EXPECT_EQ(expect, index.FindWithin("levenstein", 2));
+    expect = {{3, 0}, {5, 2}};
+    EXPECT_EQ(expect, index.FindWithin("", 2));
+    expect = {{5, 1}, {3, 2}};
+    ASSERT_EQ(expect, index.FindWithin("ba", 2));
+}
+
+TEST(FuzzyIndex, FindTopK)
+{
+    FuzzyIndex index{{"abcd", "abce", "xyz", "abcd", "abd"}};
+    std::vector<FuzzyMatch> expect{{0, 0}, {3, 0}, {1, 1}};
+    EXPECT_EQ(expect, index.FindTopK("abcd", 3));
+    expect = {{0, 0}, {3, 0}};
+    EXPECT_EQ(expect, index.FindTopK("abcd", 10, 0));
+    EXPECT_EQ(5u, index.FindTopK("abcd", 10).size());
+    ASSERT_TRUE(index.FindTopK("abcd", 0).empty());
+}
+
+TEST(FuzzyIndex, SameAsScan)
+{
+    std::mt19937 generator{42};
+    for (int round = 0; round<10; ++round)
+    {
+        auto letterCount = (round%2==0) ? 3 : 8;
+        auto words = MakeRandomWords(generator, 300, 10, letterCount);
+        FuzzyIndex index{words};
+        for (auto &query : MakeRandomWords(generator, 20, 12, letterCount))
+        {
+            auto all = FindAllByScan(words, query);
+            for (std::size_t maxDistance : {0u, 1u, 2u, 4u})
+            {
+                std::vector<FuzzyMatch> expect;
+                std::copy_if(all.begin(), all.end(), std::back_inserter(expect), [maxDistance](const FuzzyMatch &match)
+                {
+                    return match.Distance<=maxDistance;
+                });
+                ASSERT_EQ(expect, index.FindWithin(query, maxDistance)) << query << " " << maxDistance;
+            }
+            for (std::size_t k : {1u, 5u, 50u})
+            {
+                std::vector<FuzzyMatch> expect(all.begin(), all.begin()+static_cast<std::ptrdiff_t>(k));
+                ASSERT_EQ(expect, index.FindTopK(query, k)) << query << " " << k;
+            }
+        }
+    }
+}
+
+TEST(FuzzyIndex, SaveLoad)
+{
+    std::mt19937 generator{42};
+    auto words = MakeRandomWords(generator, 200, 12, 5);
+    FuzzyIndex index{words};
+
+    std::stringstream stream;
+    index.Save(stream);
+    auto loaded = FuzzyIndex::Load(stream);
+    EXPECT_EQ(words, loaded.GetWords());
+    EXPECT_EQ(index.GetNodeCount(), loaded.GetNodeCount());
+    for (auto &query : MakeRandomWords(generator, 20, 12, 5))
+    {
+        EXPECT_EQ(index.FindWithin(query, 2), loaded.FindWithin(query, 2));
+        EXPECT_EQ(index.FindTopK(query, 5), loaded.FindTopK(query, 5));
+    }
+
+    std::stringstream badMagic{"NOTINDEX"};
+    EXPECT_THROW(FuzzyIndex::Load(badMagic), std::runtime_error);
+    auto data = stream.str();
+    std::stringstream truncated{data.substr(0, data.size()/2)};
+    EXPECT_THROW(FuzzyIndex::Load(truncated), std::runtime_error);
+    ASSERT_THROW(FuzzyIndex::Load("/nonexistent/fuzzy.idx"), std::runtime_error);
+}
+
+TEST(FuzzyIndex, LoadCorruptTrie)
+{
+    //'' trie of "ab" is root, 'a', 'b'.
+    //'' offset: magic 8, version 4, word count 8, word 8+2, labels 8+3, depths 8+3*4, subtree ends 8+3*4.
+    std::stringstream stream;
+    FuzzyIndex{{"ab"}}.Save(stream);
+    auto data = stream.str();
+    constexpr std::size_t DepthsOffset = 8+4+8+10+11+8;
+    constexpr std::size_t SubtreeEndsOffset = DepthsOffset+12+8;
+
+    auto loadWith = [&data](std::size_t offset, char value)
+    {
+        auto corrupt = data;
+        corrupt[offset] = value;
+        std::stringstream corruptStream{corrupt};
+        return FuzzyIndex::Load(corruptStream);
+    };
+    EXPECT_NO_THROW(loadWith(DepthsOffset+8, 2));
+    EXPECT_THROW(loadWith(DepthsOffset, 1), std::runtime_error);
+    EXPECT_THROW(loadWith(DepthsOffset+8, 5), std::runtime_error);
+    EXPECT_THROW(loadWith(SubtreeEndsOffset, 2), std::runtime_error);
+    EXPECT_THROW(loadWith(SubtreeEndsOffset+4, 1), std::runtime_error);
+    ASSERT_THROW(loadWith(SubtreeEndsOffset+8, 2), std::runtime_error);
+}
+
+}
@@ -1,20 +1,150 @@
 #pragma once
 
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
 #include "ies/ies_export.h"
 
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace ies
 {
 
+class LevenshteinWorkspace;
+
+//! @brief DamerauLevenshtein() using buffers of [workspace] instead of thread_local workspace.
+IES_EXPORT
+std::pair<std::size_t, double>
+DamerauLevenshtein(std::string_view str1, std::string_view str2, LevenshteinWorkspace &workspace);
+
+//! @brief DamerauLevenshteinBounded() using buffers of [workspace] instead of thread_local workspace.
+IES_EXPORT
+std::optional<std::pair<std::size_t, double>>
+DamerauLevenshteinBounded(std::string_view str1, std::string_view str2, std::size_t maxDistance, LevenshteinWorkspace &workspace);
+
+//! @brief DamerauLevenshteinUtf8() using buffers of [workspace] instead of thread_local workspace.
+IES_EXPORT
+std::pair<std::size_t, double>
+DamerauLevenshteinUtf8(std::string_view str1, std::string_view str2, LevenshteinWorkspace &workspace);
+
+//! @brief DamerauLevenshteinUtf8Bounded() using buffers of [workspace] instead of thread_local workspace.
+IES_EXPORT
+std::optional<std::pair<std::size_t, double>>
+DamerauLevenshteinUtf8Bounded(std::string_view str1, std::string_view str2, std::size_t maxDistance, LevenshteinWorkspace &workspace);
+
+//! @brief Reusable buffers for DamerauLevenshtein[Utf8]() and DamerauLevenshtein[Utf8]Bounded().
+//! Buffers grow to largest input and are kept, so repeated calls do not allocate in steady state.
+//! @note Not thread safe, use one workspace per thread.
+//! Overloads without workspace use a thread_local workspace.
+//! @example
+//!     LevenshteinWorkspace workspace;
+//!     for (auto &[name, query] : pairs)
+//!     {
+//!         auto [distance, normalize] = DamerauLevenshtein(name, query, workspace);
+//!     }
+class IES_EXPORT LevenshteinWorkspace
+{
+public:
+        LevenshteinWorkspace() = default;
+
+private:
+    //'' match masks of pattern indexed by character (256 per 64 bits word), all zero between calls.
+    std::array<std::uint64_t, 256> mWordMatchMasks{};
+    std::vector<std::uint64_t> mBlockMatchMasks;
+    //'' bit vectors of blocked algorithm.
+    std::vector<std::uint64_t> mBlockStates;
+    //'' DP rows of banded algorithm, or of code points algorithm.
+    std::vector<std::size_t> mBandRows;
+    //'' decoded code points, alphabet of one string and strings mapped to byte ids for Utf8 functions.
+    std::u32string mCodePoints1;
+    std::u32string mCodePoints2;
+    std::u32string mAlphabet;
+    std::string mIds1;
+    std::string mIds2;
+
+    friend
+    std::pair<std::size_t, double>
+    DamerauLevenshtein(std::string_view str1, std::string_view str2, LevenshteinWorkspace &workspace);
+
+    friend
+    std::optional<std::pair<std::size_t, double>>
+    DamerauLevenshteinBounded(std::string_view str1, std::string_view str2, std::size_t maxDistance, LevenshteinWorkspace &workspace);
+
+    friend
+    std::pair<std::size_t, double>
+    DamerauLevenshteinUtf8(std::string_view str1, std::string_view str2, LevenshteinWorkspace &workspace);
+
+    friend
+    std::optional<std::pair<std::size_t, double>>
+    DamerauLevenshteinUtf8Bounded(std::string_view str1, std::string_view str2, std::size_t maxDistance, LevenshteinWorkspace &workspace);
+};
+
 //! @brief Compare two string and return their edit distance (Damerau-Levenshtein distance).
 //! Use to check if two strings are very similar and difference is caused by typo.
 //! @return Pair of {Levenshtein distance, Normalized Factor [0.0~1.0]}.
 //!     Normalized Factor is the similarness, where 1.0 is 100% similar.
+//! @note Distance is optimal string alignment (adjacent transposition, no substring edited twice),
+//! computed by bit-parallel algorithm (Hyyroe 2003): O(n) word operations per character of longer string,
+//! where n is 1 word for shorter string up to 64 characters.
+//! Buffers are in thread_local LevenshteinWorkspace, so no allocation in steady state.
 //! @see https://en.wikipedia.org/wiki/Damerau%E2%80%93Levenshtein_distance
 IES_EXPORT
 std::pair<std::size_t, double>
-DamerauLevenshtein(const std::string &str1, const std::string &str2);
+DamerauLevenshtein(std::string_view str1, std::string_view str2);
+
+//! @brief DamerauLevenshtein() when only distance at most [maxDistance] is interested.
+//! @return Same pair as DamerauLevenshtein() if distance<=maxDistance, otherwise std::nullopt.
+//! @note Cost is O(maxDistance) per character instead of whole table:
+//! - Rejected immediately if length difference is more than maxDistance.
+//! - Common prefix and suffix are skipped.
+//! - Long strings only compute diagonal band of width 2*maxDistance+1 (Ukkonen's cutoff),
+//!   and stop when band minimum of last two rows exceeds maxDistance.
+//! - Short strings (<=64) use one word bit-parallel algorithm and stop when distance can no longer reach maxDistance.
+//! @example
+//!     if (auto result = DamerauLevenshteinBounded(name, query, 2))
+//!     {
+//!         auto [distance, normalize] = *result;
+//!     }
+IES_EXPORT
+std::optional<std::pair<std::size_t, double>>
+DamerauLevenshteinBounded(std::string_view str1, std::string_view str2, std::size_t maxDistance);
+
+//! @brief DamerauLevenshtein() of UTF-8 strings, distance and normalize are in characters (code points) instead of bytes.
+//! @note
+//! - Strings of only ASCII (checked by SIMD) are computed as bytes directly.
+//! - Otherwise each distinct character of one string is mapped to a byte id and other characters share id 0,
+//!   distance is kept since characters are only compared across strings,
+//!   then bit-parallel algorithm runs on ids. Plain DP over code points is used
+//!   only if both strings have more than 255 distinct characters.
+//! - Invalid UTF-8 byte is one character U+DC80~U+DCFF (as Python's surrogateescape),
+//!   which never equals a valid character.
+//! @example
+//!     DamerauLevenshteinUtf8("caf\u00e9", "cafe"); //'' {1, 0.75}, DamerauLevenshtein() is {2, 0.6}.
+IES_EXPORT
+std::pair<std::size_t, double>
+DamerauLevenshteinUtf8(std::string_view str1, std::string_view str2);
+
+//! @brief DamerauLevenshteinBounded() of UTF-8 strings, in characters as DamerauLevenshteinUtf8().
+IES_EXPORT
+std::optional<std::pair<std::size_t, double>>
+DamerauLevenshteinUtf8Bounded(std::string_view str1, std::string_view str2, std::size_t maxDistance);
 
 }
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,282 @@
+#include "ies/String/LevenshteinBatch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <thread>
+
+#include "ies/Common/IntegralRange.hxx"
+#include "ies/Common/ParallelFor.hxx"
+#include "ies/Common/Simd.hpp"
+#include "ies/String/Levenshtein.hpp"
+
+#if IES_SIMD_AVX2
+#include <immintrin.h>
+#elif IES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+//'' batch smaller than this per chunk is not worth running on ThreadPool.
+constexpr std::size_t MinPairsPerThread = 4096;
+
+#if IES_SIMD_SSE2
+
+//'' strings are copied to zero padded 32 bytes per lane.
+constexpr std::size_t LaneStringSize = ies::MaxBatchLaneStringSize;
+
+//! @brief 32-bit lane operations used by OsaDistanceLanes.
+//! LoadMatches: match masks of j-th text character against pattern of each lane,
+//! by comparing character with all 32 pattern bytes, so no table per pattern is built or cleared.
+#if IES_SIMD_AVX2
+
+struct Lanes
+{
+    static constexpr std::size_t Count = 8;
+    using Vector = __m256i;
+
+    static Vector Set1(std::uint32_t value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+    static Vector Load(const std::uint32_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+    static void Store(std::uint32_t* values, Vector v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), v); }
+    static Vector And(Vector a, Vector b) { return _mm256_and_si256(a, b); }
+    static Vector AndNot(Vector a, Vector b) { return _mm256_andnot_si256(a, b); }
+    static Vector Or(Vector a, Vector b) { return _mm256_or_si256(a, b); }
+    static Vector Xor(Vector a, Vector b) { return _mm256_xor_si256(a, b); }
+    static Vector Add(Vector a, Vector b) { return _mm256_add_epi32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm256_sub_epi32(a, b); }
+    static Vector ShiftLeft1(Vector v) { return _mm256_slli_epi32(v, 1); }
+    static Vector CmpEq(Vector a, Vector b) { return _mm256_cmpeq_epi32(a, b); }
+    static Vector CmpGt(Vector a, Vector b) { return _mm256_cmpgt_epi32(a, b); }
+
+    static int
+    LaneMatch(const unsigned char* pattern, unsigned char c)
+    {
+        auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pattern));
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(static_cast<char>(c))));
+    }
+
+    static Vector
+    LoadMatches(const unsigned char* patternBytes, const unsigned char* textBytes, std::size_t j)
+    {
+        return _mm256_setr_epi32(
+            LaneMatch(patternBytes, textBytes[j]),
+            LaneMatch(patternBytes+LaneStringSize, textBytes[LaneStringSize+j]),
+            LaneMatch(patternBytes+2*LaneStringSize, textBytes[2*LaneStringSize+j]),
+            LaneMatch(patternBytes+3*LaneStringSize, textBytes[3*LaneStringSize+j]),
+            LaneMatch(patternBytes+4*LaneStringSize, textBytes[4*LaneStringSize+j]),
+            LaneMatch(patternBytes+5*LaneStringSize, textBytes[5*LaneStringSize+j]),
+            LaneMatch(patternBytes+6*LaneStringSize, textBytes[6*LaneStringSize+j]),
+            LaneMatch(patternBytes+7*LaneStringSize, textBytes[7*LaneStringSize+j]));
+    }
+};
+
+#else
+
+struct Lanes
+{
+    static constexpr std::size_t Count = 4;
+    using Vector = __m128i;
+
+    static Vector Set1(std::uint32_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+    static Vector Load(const std::uint32_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+    static void Store(std::uint32_t* values, Vector v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), v); }
+    static Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+    static Vector AndNot(Vector a, Vector b) { return _mm_andnot_si128(a, b); }
+    static Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+    static Vector Xor(Vector a, Vector b) { return _mm_xor_si128(a, b); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_epi32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_epi32(a, b); }
+    static Vector ShiftLeft1(Vector v) { return _mm_slli_epi32(v, 1); }
+    static Vector CmpEq(Vector a, Vector b) { return _mm_cmpeq_epi32(a, b); }
+    static Vector CmpGt(Vector a, Vector b) { return _mm_cmpgt_epi32(a, b); }
+
+    static int
+    LaneMatch(const unsigned char* pattern, unsigned char c)
+    {
+        auto broadcast = _mm_set1_epi8(static_cast<char>(c));
+        auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+        auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern+16));
+        auto lowMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(low, broadcast)));
+        auto highMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(high, broadcast)));
+        return static_cast<int>(lowMask|(highMask<<16));
+    }
+
+    static Vector
+    LoadMatches(const unsigned char* patternBytes, const unsigned char* textBytes, std::size_t j)
+    {
+        return _mm_setr_epi32(
+            LaneMatch(patternBytes, textBytes[j]),
+            LaneMatch(patternBytes+LaneStringSize, textBytes[LaneStringSize+j]),
+            LaneMatch(patternBytes+2*LaneStringSize, textBytes[2*LaneStringSize+j]),
+            LaneMatch(patternBytes+3*LaneStringSize, textBytes[3*LaneStringSize+j]));
+    }
+};
+
+#endif
+
+//! @brief Bit-parallel OSA distance (Hyyroe 2003, same as DamerauLevenshtein()) of Lanes::Count pairs,
+//! lane l runs [patterns[l]] against [texts[l]], both at most 32 characters.
+//! Bits of zero padding above pattern only carry upward, so never change distance at pattern's last bit.
+//! Lanes with shorter text stop updating distance at end of its text.
+void
+OsaDistanceLanes(
+    const std::array<std::string_view, Lanes::Count> &patterns,
+    const std::array<std::string_view, Lanes::Count> &texts,
+    std::array<std::uint32_t, Lanes::Count> &distances)
+{
+    constexpr auto Count = Lanes::Count;
+    alignas(32) std::array<unsigned char, LaneStringSize*Count> patternBytes{};
+    alignas(32) std::array<unsigned char, LaneStringSize*Count> textBytes{};
+    std::array<std::uint32_t, Count> lastBits{};
+    std::array<std::uint32_t, Count> textSizes{};
+    std::size_t maxTextSize = 0;
+    for (std::size_t lane = 0; lane<Count; ++lane)
+    {
+        auto pattern = patterns[lane];
+        auto text = texts[lane];
+        std::copy(pattern.begin(), pattern.end(), patternBytes.begin()+static_cast<std::ptrdiff_t>(lane*LaneStringSize));
+        std::copy(text.begin(), text.end(), textBytes.begin()+static_cast<std::ptrdiff_t>(lane*LaneStringSize));
+        //'' empty pattern lane is inactive, distance is text size.
+        distances[lane] = static_cast<std::uint32_t>(pattern.empty() ? text.size() : pattern.size());
+        if (!pattern.empty())
+        {
+            lastBits[lane] = std::uint32_t{1}<<(pattern.size()-1);
+            textSizes[lane] = static_cast<std::uint32_t>(text.size());
+            maxTextSize = std::max(maxTextSize, text.size());
+        }
+    }
+
+    auto allOnes = Lanes::Set1(~std::uint32_t{0});
+    auto one = Lanes::Set1(1);
+    auto vp = allOnes;
+    auto vn = Lanes::Set1(0);
+    auto d0 = Lanes::Set1(0);
+    auto previousMatch = Lanes::Set1(0);
+    auto lastBit = Lanes::Load(lastBits.data());
+    auto textSize = Lanes::Load(textSizes.data());
+    auto distance = Lanes::Load(distances.data());
+
+    for (std::size_t j = 0; j<maxTextSize; ++j)
+    {
+        auto match = Lanes::LoadMatches(patternBytes.data(), textBytes.data(), j);
+        auto tr = Lanes::And(Lanes::ShiftLeft1(Lanes::AndNot(d0, match)), previousMatch);
+        d0 = Lanes::Or(Lanes::Or(Lanes::Xor(Lanes::Add(Lanes::And(match, vp), vp), vp), match), Lanes::Or(vn, tr));
+        auto hp = Lanes::Or(vn, Lanes::AndNot(Lanes::Or(d0, vp), allOnes));
+        auto hn = Lanes::And(d0, vp);
+
+        //'' all ones (-1) in lane if bit set and lane's text is not ended.
+        auto active = Lanes::CmpGt(textSize, Lanes::Set1(static_cast<std::uint32_t>(j)));
+        distance = Lanes::Sub(distance, Lanes::And(Lanes::CmpEq(Lanes::And(hp, lastBit), lastBit), active));
+        distance = Lanes::Add(distance, Lanes::And(Lanes::CmpEq(Lanes::And(hn, lastBit), lastBit), active));
+
+        hp = Lanes::Or(Lanes::ShiftLeft1(hp), one);
+        hn = Lanes::ShiftLeft1(hn);
+        vp = Lanes::Or(hn, Lanes::AndNot(Lanes::Or(d0, hp), allOnes));
+        vn = Lanes::And(hp, d0);
+        previousMatch = match;
+    }
+    Lanes::Store(distances.data(), distance);
+}
+
+void
+ComputeDistances(std::span<const ies::StringViewPair> pairs, std::span<std::size_t> distances)
+{
+    constexpr auto Count = Lanes::Count;
+    std::array<std::string_view, Count> patterns;
+    std::array<std::string_view, Count> texts;
+    std::array<std::size_t, Count> pairIndices{};
+    std::array<std::uint32_t, Count> laneDistances{};
+    std::size_t laneCount = 0;
+
+    auto runLanes = [&]()
+    {
+        for (auto lane = laneCount; lane<Count; ++lane)
+        {
+            patterns[lane] = {};
+            texts[lane] = {};
+        }
+        OsaDistanceLanes(patterns, texts, laneDistances);
+        for (std::size_t lane = 0; lane<laneCount; ++lane)
+        {
+            distances[pairIndices[lane]] = laneDistances[lane];
+        }
+        laneCount = 0;
+    };
+
+    for (std::size_t i = 0; i<pairs.size(); ++i)
+    {
+        //'' bit-parallel algorithm does not need pattern shorter than text when both fit in lane.
+        auto [pattern, text] = pairs[i];
+        if (std::max(pattern.size(), text.size())>ies::MaxBatchLaneStringSize)
+        {
+            distances[i] = ies::DamerauLevenshtein(pattern, text).first;
+            continue;
+        }
+        patterns[laneCount] = pattern;
+        texts[laneCount] = text;
+        pairIndices[laneCount] = i;
+        ++laneCount;
+        if (laneCount==Count)
+        {
+            runLanes();
+        }
+    }
+    if (laneCount>0)
+    {
+        runLanes();
+    }
+}
+
+#else
+
+void
+ComputeDistances(std::span<const ies::StringViewPair> pairs, std::span<std::size_t> distances)
+{
+    for (std::size_t i = 0; i<pairs.size(); ++i)
+    {
+        distances[i] = ies::DamerauLevenshtein(pairs[i].first, pairs[i].second).first;
+    }
+}
+
+#endif
+
+}
+
+namespace ies
+{
+
+void
+DamerauLevenshteinBatch(std::span<const StringViewPair> pairs, std::span<std::size_t> distances, std::size_t threadCount)
+{
+    if (distances.size()!=pairs.size())
+    {
+        throw std::runtime_error("DamerauLevenshteinBatch: distances size is not pairs size.");
+    }
+
+    if (threadCount==0)
+    {
+        threadCount = std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, std::max(std::size_t{1}, pairs.size()/MinPairsPerThread));
+    if (threadCount==1)
+    {
+        ComputeDistances(pairs, distances);
+        return;
+    }
+
+    auto chunkSize = (pairs.size()+threadCount-1)/threadCount;
+    auto chunkCount = (pairs.size()+chunkSize-1)/chunkSize;
+    ParallelFor(IndexRange{0, chunkCount}, [&](std::size_t chunk)
+    {
+        auto begin = chunk*chunkSize;
+        auto size = std::min(chunkSize, pairs.size()-begin);
+        ComputeDistances(pairs.subspan(begin, size), distances.subspan(begin, size));
+    }, 1);
+}
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp20.hpp" // IWYU pragma: keep
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace ies
+{
+
+using StringViewPair = std::pair<std::string_view, std::string_view>;
+
+//! @brief Pairs with both strings up to this size are computed in SIMD lanes by DamerauLevenshteinBatch().
+inline constexpr std::size_t MaxBatchLaneStringSize = 32;
+
+//! @brief Compute DamerauLevenshtein() distance of each pair in [pairs] into [distances].
+//! Short pairs are computed by bit-parallel algorithm with one pair per 32-bit SIMD lane
+//! (8 pairs per step for AVX2, 4 for SSE2), without allocation per pair.
+//! Longer pairs, and all pairs when SIMD is not available, are computed by DamerauLevenshtein() one by one.
+//! @note Pairs are split to at most [threadCount] chunks run by ParallelFor on ThreadPool::GetGlobal(),
+//! 0 means std::thread::hardware_concurrency(). Small batches are not split.
+//! @throw std::runtime_error if distances.size() is not pairs.size().
+//! @example
+//!     std::vector<StringViewPair> pairs{{"kitten", "sitting"}, {"ab", "ba"}};
+//!     std::vector<std::size_t> distances(pairs.size());
+//!     DamerauLevenshteinBatch(pairs, distances); //'' {3, 1}
+IES_EXPORT
+void
+DamerauLevenshteinBatch(std::span<const StringViewPair> pairs, std::span<std::size_t> distances, std::size_t threadCount=1);
+
+}
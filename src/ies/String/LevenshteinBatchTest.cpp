@@ -0,0 +1,79 @@
+#include "ies/String/LevenshteinBatch.hpp"
+
+#include "ies/String/Levenshtein.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+std::string
+MakeRandomString(std::mt19937 &generator, std::size_t size, int letterCount)
+{
+    std::uniform_int_distribution<int> charDistribution{0, letterCount-1};
+    std::string s;
+    for (std::size_t i = 0; i<size; ++i)
+    {
+        s += static_cast<char>('a'+charDistribution(generator));
+    }
+    return s;
+}
+
+}
+
+TEST(LevenshteinBatch, Basic)
+{
+    std::vector<StringViewPair> pairs{{"kitten", "sitting"}, {"ab", "ba"}, {"", "abc"}, {"abc", ""}, {"", ""}, {"ca", "abc"}};
+    std::vector<std::size_t> distances(pairs.size());
+    DamerauLevenshteinBatch(pairs, distances);
+    std::vector<std::size_t> expect{3, 1, 3, 3, 0, 3};
+    EXPECT_EQ(expect, distances);
+
+    std::vector<std::size_t> wrongSize(1);
+    ASSERT_THROW(DamerauLevenshteinBatch(pairs, wrongSize), std::runtime_error);
+}
+
+TEST(LevenshteinBatch, SameAsDamerauLevenshtein)
+{
+    std::mt19937 generator{42};
+    std::vector<std::string> strings;
+    for (std::size_t i = 0; i<20000; ++i)
+    {
+        //'' mostly short strings for lanes, some longer than lane size.
+        auto maxSize = (i%50==0) ? 80u : MaxBatchLaneStringSize;
+        auto size = std::uniform_int_distribution<std::size_t>{0, maxSize}(generator);
+        strings.emplace_back(MakeRandomString(generator, size, (i%3==0) ? 2 : 6));
+    }
+    //'' non-ASCII and zero bytes use same table as other bytes.
+    strings[1] = std::string{"a\0\xff\x80", 4};
+    strings[3] = std::string{"\xff\0a", 3};
+
+    std::vector<StringViewPair> pairs;
+    for (std::size_t i = 0; i+1<strings.size(); i += 2)
+    {
+        pairs.emplace_back(strings[i], strings[i+1]);
+    }
+
+    std::vector<std::size_t> expect;
+    for (auto &[str1, str2] : pairs)
+    {
+        expect.emplace_back(DamerauLevenshtein(std::string{str1}, std::string{str2}).first);
+    }
+
+    for (std::size_t threadCount : {1u, 4u, 0u})
+    {
+        std::vector<std::size_t> distances(pairs.size());
+        DamerauLevenshteinBatch(pairs, distances, threadCount);
+        ASSERT_EQ(expect, distances) << threadCount;
+    }
+}
+
+}
@@ -2,11 +2,133 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <random>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace ies
 {
 
+namespace
+{
+
+//'' reference full table OSA distance.
+template <typename String>
+std::size_t
+OsaDistanceByTable(const String &str1, const String &str2)
+{
+    std::vector<std::vector<std::size_t>> table(str1.size()+1, std::vector<std::size_t>(str2.size()+1, 0));
+    for (std::size_t i = 0; i<=str1.size(); ++i)
+    {
+        table[i][0] = i;
+    }
+    for (std::size_t j = 0; j<=str2.size(); ++j)
+    {
+        table[0][j] = j;
+    }
+    for (std::size_t i = 1; i<=str1.size(); ++i)
+    {
+        for (std::size_t j = 1; j<=str2.size(); ++j)
+        {
+            auto cost = (str1[i-1]==str2[j-1]) ? 0u : 1u;
+            table[i][j] = std::min({table[i-1][j]+1, table[i][j-1]+1, table[i-1][j-1]+cost});
+            if (i>1 && j>1 && str1[i-1]==str2[j-2] && str1[i-2]==str2[j-1])
+            {
+                table[i][j] = std::min(table[i][j], table[i-2][j-2]+1);
+            }
+        }
+    }
+    return table[str1.size()][str2.size()];
+}
+
+std::string
+MakeRandomString(std::mt19937 &generator, std::size_t size, int letterCount)
+{
+    std::uniform_int_distribution<int> charDistribution{0, letterCount-1};
+    std::string s;
+    for (std::size_t i = 0; i<size; ++i)
+    {
+        s += static_cast<char>('a'+charDistribution(generator));
+    }
+    return s;
+}
+
+//'' mutate [s] by [editCount] random insert/delete/substitute/transpose.
+std::string
+MakeEditedString(std::mt19937 &generator, std::string s, int editCount, int letterCount)
+{
+    for (int edit = 0; edit<editCount; ++edit)
+    {
+        auto pos = std::uniform_int_distribution<std::size_t>{0, s.size()}(generator);
+        auto c = static_cast<char>('a'+std::uniform_int_distribution<int>{0, letterCount-1}(generator));
+        switch (std::uniform_int_distribution<int>{0, 3}(generator))
+        {
+            case 0:
+                s.insert(s.begin()+static_cast<std::ptrdiff_t>(pos), c);
+                break;
+            case 1:
+                if (pos<s.size()) { s.erase(pos, 1); }
+                break;
+            case 2:
+                if (pos<s.size()) { s[pos] = c; }
+                break;
+            default:
+                if (pos+1<s.size()) { std::swap(s[pos], s[pos+1]); }
+                break;
+        }
+    }
+    return s;
+}
+
+std::string
+EncodeUtf8(const std::u32string &codePoints)
+{
+    std::string s;
+    for (auto c : codePoints)
+    {
+        if (c<0x80)
+        {
+            s += static_cast<char>(c);
+        }
+        else if (c<0x800)
+        {
+            s += static_cast<char>(0xC0|(c>>6));
+            s += static_cast<char>(0x80|(c&0x3F));
+        }
+        else if (c<0x10000)
+        {
+            s += static_cast<char>(0xE0|(c>>12));
+            s += static_cast<char>(0x80|((c>>6)&0x3F));
+            s += static_cast<char>(0x80|(c&0x3F));
+        }
+        else
+        {
+            s += static_cast<char>(0xF0|(c>>18));
+            s += static_cast<char>(0x80|((c>>12)&0x3F));
+            s += static_cast<char>(0x80|((c>>6)&0x3F));
+            s += static_cast<char>(0x80|(c&0x3F));
+        }
+    }
+    return s;
+}
+
+//'' random code points from [alphabet].
+std::u32string
+MakeRandomCodePoints(std::mt19937 &generator, std::size_t size, const std::u32string &alphabet)
+{
+    std::uniform_int_distribution<std::size_t> indexDistribution{0, alphabet.size()-1};
+    std::u32string s;
+    for (std::size_t i = 0; i<size; ++i)
+    {
+        s += alphabet[indexDistribution(generator)];
+    }
+    return s;
+}
+
+}
+
 TEST(Levenshtein, EmptyStrings)
 {
     std::string str1;
@@ -34,4 +156,167 @@ TEST(Levenshtein, SimilarStrings)
     ASSERT_DOUBLE_EQ(0.8, normalize);
 }
 
+TEST(Levenshtein, Transposition)
+{
+    EXPECT_EQ(1u, DamerauLevenshtein("ab", "ba").first);
+    //'' optimal string alignment does not edit transposed substring again, unrestricted distance is 2.
+    EXPECT_EQ(3u, DamerauLevenshtein("ca", "abc").first);
+    EXPECT_EQ(3u, DamerauLevenshtein("", "abc").first);
+    ASSERT_EQ(3u, DamerauLevenshtein("abc", "").first);
+}
+
+TEST(Levenshtein, SameAsTable)
+{
+    std::mt19937 generator{42};
+    for (std::size_t size : {1u, 2u, 5u, 31u, 63u, 64u, 65u, 100u, 127u, 128u, 129u, 200u})
+    {
+        for (int round = 0; round<30; ++round)
+        {
+            auto letterCount = (round%3==0) ? 2 : 5;
+            auto str1 = MakeRandomString(generator, size, letterCount);
+            auto str2 = (round%2==0)
+                ? MakeEditedString(generator, str1, round%10+1, letterCount)
+                : MakeRandomString(generator, std::uniform_int_distribution<std::size_t>{0, size+10}(generator), letterCount);
+
+            auto expect = OsaDistanceByTable(str1, str2);
+            auto [distance, normalize] = DamerauLevenshtein(str1, str2);
+            ASSERT_EQ(expect, distance) << str1 << " " << str2;
+            ASSERT_EQ(expect, DamerauLevenshtein(str2, str1).first) << str1 << " " << str2;
+
+            auto maxSize = static_cast<double>(std::max(str1.size(), str2.size()));
+            ASSERT_DOUBLE_EQ((maxSize-static_cast<double>(expect))/maxSize, normalize);
+        }
+    }
+}
+
+TEST(Levenshtein, Bounded)
+{
+    EXPECT_EQ(DamerauLevenshtein("abcde", "abcd"), DamerauLevenshteinBounded("abcde", "abcd", 1));
+    EXPECT_FALSE(DamerauLevenshteinBounded("abcde", "abcd", 0));
+    EXPECT_FALSE(DamerauLevenshteinBounded("abcdefgh", "ab", 5));
+    EXPECT_EQ(DamerauLevenshtein("", ""), DamerauLevenshteinBounded("", "", 0));
+    ASSERT_EQ(DamerauLevenshtein("ab", "ba"), DamerauLevenshteinBounded("ab", "ba", 1));
+}
+
+TEST(Levenshtein, BoundedSameAsTable)
+{
+    std::mt19937 generator{42};
+    for (std::size_t size : {3u, 30u, 64u, 65u, 100u, 200u, 300u})
+    {
+        for (int round = 0; round<40; ++round)
+        {
+            auto letterCount = (round%3==0) ? 2 : 5;
+            auto str1 = MakeRandomString(generator, size, letterCount);
+            auto str2 = MakeEditedString(generator, str1, round%8+1, letterCount);
+            auto expect = OsaDistanceByTable(str1, str2);
+            for (std::size_t maxDistance : {0u, 1u, 2u, 3u, 5u, 8u, 40u})
+            {
+                auto result = DamerauLevenshteinBounded(str1, str2, maxDistance);
+                if (expect>maxDistance)
+                {
+                    ASSERT_FALSE(result) << str1 << " " << str2 << " " << maxDistance;
+                }
+                else
+                {
+                    ASSERT_TRUE(result) << str1 << " " << str2 << " " << maxDistance;
+                    ASSERT_EQ(DamerauLevenshtein(str1, str2), *result);
+                }
+            }
+        }
+    }
+}
+
+TEST(Levenshtein, Workspace)
+{
+    //'' reused workspace must give same result for any order of sizes and algorithms.
+    std::mt19937 generator{42};
+    LevenshteinWorkspace workspace;
+    for (int round = 0; round<300; ++round)
+    {
+        auto size = std::uniform_int_distribution<std::size_t>{0, 200}(generator);
+        auto str1 = MakeRandomString(generator, size, 4);
+        auto str2 = MakeEditedString(generator, str1, round%12+1, 4);
+        auto expect = OsaDistanceByTable(str1, str2);
+        ASSERT_EQ(expect, DamerauLevenshtein(str1, str2, workspace).first) << str1 << " " << str2;
+
+        std::size_t maxDistance = static_cast<std::size_t>(round%8);
+        auto result = DamerauLevenshteinBounded(str1, str2, maxDistance, workspace);
+        ASSERT_EQ(expect<=maxDistance, result.has_value()) << str1 << " " << str2;
+    }
+}
+
+TEST(Levenshtein, StringView)
+{
+    std::string_view text = "kitten sitting";
+    EXPECT_EQ(3u, DamerauLevenshtein(text.substr(0, 6), text.substr(7)).first);
+    ASSERT_EQ(3u, DamerauLevenshteinBounded(text.substr(0, 6), text.substr(7), 3)->first);
+}
+
+TEST(Levenshtein, Utf8)
+{
+    EXPECT_EQ(std::make_pair(std::size_t{2}, 0.6), DamerauLevenshtein("caf\u00e9", "cafe"));
+    EXPECT_EQ(std::make_pair(std::size_t{1}, 0.75), DamerauLevenshteinUtf8("caf\u00e9", "cafe"));
+    EXPECT_EQ(1u, DamerauLevenshteinUtf8("\u65e5\u672c\u8a9e", "\u65e5\u672c\u4eba").first);
+    EXPECT_EQ(1u, DamerauLevenshteinUtf8("\u65e5\u672c", "\u672c\u65e5").first);
+    EXPECT_EQ(1u, DamerauLevenshteinUtf8("\U0001F600", "\U0001F601").first);
+    EXPECT_EQ(DamerauLevenshtein("kitten", "sitting"), DamerauLevenshteinUtf8("kitten", "sitting"));
+    //'' invalid bytes are one character each.
+    EXPECT_EQ(0u, DamerauLevenshteinUtf8("\xff", "\xff").first);
+    EXPECT_EQ(1u, DamerauLevenshteinUtf8("\xff", "\xfe").first);
+    EXPECT_EQ(2u, DamerauLevenshteinUtf8("a\xe6\x97", "a").first);
+    EXPECT_EQ(1u, DamerauLevenshteinUtf8("\xed\xa0\x80", "\xed\xa0").first);
+    EXPECT_EQ(std::make_pair(std::size_t{1}, 0.75), DamerauLevenshteinUtf8Bounded("caf\u00e9", "cafe", 1));
+    ASSERT_FALSE(DamerauLevenshteinUtf8Bounded("caf\u00e9", "cafe", 0));
+}
+
+TEST(Levenshtein, Utf8SameAsTable)
+{
+    std::mt19937 generator{42};
+    std::u32string mixedAlphabet = U"ab\u00e9\u00fc\u65e5\u672c\U0001F600";
+    //'' more than 255 distinct characters in both strings uses code points algorithm.
+    std::u32string largeAlphabet;
+    for (char32_t c = 0x4E00; c<0x4E00+400; ++c)
+    {
+        largeAlphabet += c;
+    }
+
+    for (int round = 0; round<120; ++round)
+    {
+        auto isLarge = (round%8==0);
+        auto &alphabet = isLarge ? largeAlphabet : mixedAlphabet;
+        auto size = isLarge ? 400u : std::uniform_int_distribution<std::size_t>{0, 150u}(generator);
+        auto codePoints1 = isLarge ? largeAlphabet : MakeRandomCodePoints(generator, size, alphabet);
+        if (isLarge)
+        {
+            std::shuffle(codePoints1.begin(), codePoints1.end(), generator);
+        }
+        auto codePoints2 = codePoints1;
+        for (int edit = 0; edit<round%10; ++edit)
+        {
+            auto pos = std::uniform_int_distribution<std::size_t>{0, codePoints2.size()}(generator);
+            if (pos+1<codePoints2.size())
+            {
+                std::swap(codePoints2[pos], codePoints2[pos+1]);
+            }
+            codePoints2.insert(pos, 1, alphabet[static_cast<std::size_t>(edit)%alphabet.size()]);
+        }
+
+        auto expect = OsaDistanceByTable(codePoints1, codePoints2);
+        auto str1 = EncodeUtf8(codePoints1);
+        auto str2 = EncodeUtf8(codePoints2);
+        auto [distance, normalize] = DamerauLevenshteinUtf8(str1, str2);
+        ASSERT_EQ(expect, distance) << round;
+        auto maxSize = static_cast<double>(std::max(codePoints1.size(), codePoints2.size()));
+        if (maxSize>0)
+        {
+            ASSERT_DOUBLE_EQ((maxSize-static_cast<double>(expect))/maxSize, normalize);
+        }
+        for (std::size_t maxDistance : {0u, 3u, 8u})
+        {
+            auto result = DamerauLevenshteinUtf8Bounded(str1, str2, maxDistance);
+            ASSERT_EQ(expect<=maxDistance, result.has_value()) << round << " " << maxDistance;
+        }
+    }
+}
+
 }
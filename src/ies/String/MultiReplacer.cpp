@@ -0,0 +1,220 @@
+#include "ies/String/MultiReplacer.hpp"
+
+#include <queue>
+#include <stdexcept>
+
+namespace
+{
+
+constexpr std::int32_t NoState = -1;
+constexpr std::int32_t NoRule = -1;
+
+}
+
+namespace ies
+{
+
+MultiReplacer::
+MultiReplacer(const ReplaceRuleList &rules, MultiReplaceMode mode)
+:   mMode(mode)
+{
+    for (auto &[from, to] : rules)
+    {
+        for (auto c : from)
+        {
+            auto &byteClass = mByteClasses[static_cast<unsigned char>(c)];
+            if (byteClass==0)
+            {
+                byteClass = static_cast<std::uint16_t>(mClassCount);
+                ++mClassCount;
+            }
+        }
+    }
+
+    //'' build trie of patterns, missing transition is NoState.
+    mTransitions.assign(mClassCount, NoState);
+    mDepths.assign(1, 0);
+    mMatchRules.assign(1, NoRule);
+    mMatchLengths.assign(1, 0);
+
+    for (auto &[from, to] : rules)
+    {
+        if (from.empty())
+        {
+            continue;
+        }
+        if (mMode==MultiReplaceMode::Recursive && to.find(from)!=std::string::npos)
+        {
+            throw std::runtime_error("MultiReplacer: recursive rule ["+from+"] => ["+to+"] never reaches fixed point.");
+        }
+
+        std::size_t state = 0;
+        for (auto c : from)
+        {
+            auto index = state*mClassCount+mByteClasses[static_cast<unsigned char>(c)];
+            if (mTransitions[index]==NoState)
+            {
+                auto newState = mDepths.size();
+                mTransitions[index] = static_cast<std::int32_t>(newState);
+                mTransitions.resize(mTransitions.size()+mClassCount, NoState);
+                mDepths.emplace_back(mDepths[state]+1);
+                mMatchRules.emplace_back(NoRule);
+                mMatchLengths.emplace_back(0);
+            }
+            state = static_cast<std::size_t>(mTransitions[index]);
+        }
+
+        if (mMatchRules[state]==NoRule)
+        {
+            mMatchRules[state] = static_cast<std::int32_t>(mReplacements.size());
+            mMatchLengths[state] = from.size();
+            mReplacements.emplace_back(to);
+        }
+    }
+
+    //'' BFS to fill fail transitions, so transition table becomes a complete DFA.
+    //'' A state without own pattern inherits longest pattern of its fail state.
+    std::vector<std::size_t> failStates(mDepths.size(), 0);
+    std::queue<std::size_t> queue;
+    for (std::size_t byteClass = 0; byteClass<mClassCount; ++byteClass)
+    {
+        auto &next = mTransitions[byteClass];
+        if (next==NoState)
+        {
+            next = 0;
+        }
+        else
+        {
+            queue.push(static_cast<std::size_t>(next));
+        }
+    }
+
+    while (!queue.empty())
+    {
+        auto state = queue.front();
+        queue.pop();
+        auto failState = failStates[state];
+        for (std::size_t byteClass = 0; byteClass<mClassCount; ++byteClass)
+        {
+            auto &next = mTransitions[state*mClassCount+byteClass];
+            auto failNext = mTransitions[failState*mClassCount+byteClass];
+            if (next==NoState)
+            {
+                next = failNext;
+                continue;
+            }
+
+            auto child = static_cast<std::size_t>(next);
+            failStates[child] = static_cast<std::size_t>(failNext);
+            if (mMatchRules[child]==NoRule)
+            {
+                mMatchRules[child] = mMatchRules[failStates[child]];
+                mMatchLengths[child] = mMatchLengths[failStates[child]];
+            }
+            queue.push(child);
+        }
+    }
+}
+
+std::string
+MultiReplacer::
+Replace(std::string_view input)
+const
+{
+    std::string output;
+    if (!ReplacePass(input, output) || mMode==MultiReplaceMode::SinglePass)
+    {
+        return output;
+    }
+
+    std::string buffer;
+    while (ReplacePass(output, buffer))
+    {
+        output.swap(buffer);
+    }
+    return output;
+}
+
+void
+MultiReplacer::
+ReplaceInPlace(std::string &s)
+const
+{
+    s = Replace(s);
+}
+
+MultiReplaceMode
+MultiReplacer::
+GetMode()
+const
+{
+    return mMode;
+}
+
+std::size_t
+MultiReplacer::
+GetStateCount()
+const
+{
+    return mDepths.size();
+}
+
+bool
+MultiReplacer::
+ReplacePass(std::string_view input, std::string &output)
+const
+{
+    output.clear();
+    output.reserve(input.size());
+
+    constexpr auto NoMatch = std::string_view::npos;
+    auto size = input.size();
+    bool isReplaced = false;
+
+    //'' input before [copied] is already written to output.
+    std::size_t copied = 0;
+    std::size_t state = 0;
+    //'' leftmost-longest candidate match [matchBegin, matchEnd) not yet committed.
+    auto matchBegin = NoMatch;
+    std::size_t matchEnd = 0;
+    std::int32_t matchRule = NoRule;
+
+    std::size_t i = 0;
+    while (i<size || matchBegin!=NoMatch)
+    {
+        if (i<size)
+        {
+            state = static_cast<std::size_t>(mTransitions[state*mClassCount+mByteClasses[static_cast<unsigned char>(input[i])]]);
+            ++i;
+
+            if (auto rule = mMatchRules[state]; rule!=NoRule)
+            {
+                auto begin = i-mMatchLengths[state];
+                if (matchBegin==NoMatch || begin<matchBegin || (begin==matchBegin && i>matchEnd))
+                {
+                    matchBegin = begin;
+                    matchEnd = i;
+                    matchRule = rule;
+                }
+            }
+        }
+
+        //'' any later match starts at or after i-depth, so candidate is final when it starts before that.
+        if (matchBegin!=NoMatch && (i==size || matchBegin<i-mDepths[state]))
+        {
+            output.append(input, copied, matchBegin-copied);
+            output += mReplacements[static_cast<std::size_t>(matchRule)];
+            copied = matchEnd;
+            //'' rescan text after match, which may be partly consumed by longer unfinished candidates.
+            i = matchEnd;
+            state = 0;
+            matchBegin = NoMatch;
+            isReplaced = true;
+        }
+    }
+
+    output.append(input, copied, size-copied);
+    return isReplaced;
+}
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ies/Common/SmartEnum.hxx"
+
+namespace ies
+{
+
+//! @brief How MultiReplacer rewrites a string.
+//! SinglePass: scan once, replaced text is not scanned again.
+//! Recursive: repeat SinglePass until no pattern occurs in string (fixed point).
+IES_SMART_ENUM(MultiReplaceMode,
+    SinglePass,
+    Recursive
+);
+
+//! @brief List of {From, To} replacement rules.
+using ReplaceRuleList = std::vector<std::pair<std::string, std::string>>;
+
+//! @brief Compiled replacer of many {From, To} rules, rewrite string in one scan per pass
+//! by an Aho-Corasick automaton of all From patterns.
+//! Each pass scans left to right and replaces leftmost occurrence of any pattern,
+//! longest pattern wins if several start at same position, then continues after the occurrence.
+//! @note Rules with empty From are ignored. If same From appears in several rules, first rule is used.
+//! @note Recursive mode with cyclic rules (e.g. {"a", "b"}, {"b", "a"}) never stops, caller must avoid such rules.
+//! @note Compared with applying RecursiveReplace for each rule in sequence:
+//! - All rules are applied in one scan instead of one scan per rule, into a fresh output buffer.
+//! - Recursive mode stops when no pattern occurs in whole string. (RecursiveReplace only rescans from replaced position.)
+//! @example
+//!     MultiReplacer replacer{{{"//", "/"}, {"\\", "/"}}};
+//!     replacer.Replace("a\\\\b//c") => "a/b/c"
+class IES_EXPORT MultiReplacer
+{
+public:
+    //! @throw std::runtime_error in Recursive mode if a rule's To contains its From (never reaches fixed point).
+        explicit MultiReplacer(const ReplaceRuleList &rules, MultiReplaceMode mode=MultiReplaceMode::Recursive);
+
+    //! @brief Return [input] with rules applied.
+        std::string
+        Replace(std::string_view input)
+        const;
+
+    //! @brief Apply rules to [s].
+        void
+        ReplaceInPlace(std::string &s)
+        const;
+
+        MultiReplaceMode
+        GetMode()
+        const;
+
+    //! @brief Get state count of automaton, for diagnosing memory use (states*byte classes transitions).
+        std::size_t
+        GetStateCount()
+        const;
+
+private:
+    MultiReplaceMode mMode;
+    std::vector<std::string> mReplacements;
+    //'' bytes not in any pattern share class 0, so transition table width is number of distinct pattern bytes+1.
+    //'' uint16_t since all 256 bytes in patterns need 257 classes.
+    std::array<std::uint16_t, 256> mByteClasses{};
+    std::size_t mClassCount{1};
+    //'' DFA transitions: mTransitions[state*mClassCount+class].
+    std::vector<std::int32_t> mTransitions;
+    std::vector<std::size_t> mDepths;
+    //'' longest pattern ending at state (state itself or by fail links): replacement index, -1 if none.
+    std::vector<std::int32_t> mMatchRules;
+    std::vector<std::size_t> mMatchLengths;
+
+    //! @brief Run one pass from [input] to [output] (cleared first).
+    //! @return true if any replacement is made.
+        bool
+        ReplacePass(std::string_view input, std::string &output)
+        const;
+};
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
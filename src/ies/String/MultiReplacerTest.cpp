@@ -0,0 +1,175 @@
+#include "ies/String/MultiReplacer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace ies
+{
+
+namespace
+{
+
+//'' reference pass: try every rule at every position, first longest wins.
+bool
+NaiveReplacePass(const ReplaceRuleList &rules, const std::string &input, std::string &output)
+{
+    output.clear();
+    bool isReplaced = false;
+    std::size_t i = 0;
+    while (i<input.size())
+    {
+        const std::pair<std::string, std::string>* bestRule = nullptr;
+        for (auto &rule : rules)
+        {
+            if (input.compare(i, rule.first.size(), rule.first)==0
+                && (bestRule==nullptr || rule.first.size()>bestRule->first.size()))
+            {
+                bestRule = &rule;
+            }
+        }
+        if (bestRule==nullptr)
+        {
+            output += input[i];
+            ++i;
+            continue;
+        }
+        output += bestRule->second;
+        i += bestRule->first.size();
+        isReplaced = true;
+    }
+    return isReplaced;
+}
+
+}
+
+TEST(MultiReplacer, Empty)
+{
+    MultiReplacer replacer{{}};
+    EXPECT_EQ("", replacer.Replace(""));
+    EXPECT_EQ("abc", replacer.Replace("abc"));
+    ASSERT_EQ(1u, replacer.GetStateCount());
+}
+
+TEST(MultiReplacer, EmptyFrom)
+{
+    MultiReplacer replacer{{{"", "/"}}};
+    ASSERT_EQ("a///////b//c/d//e////", replacer.Replace("a///////b//c/d//e////"));
+}
+
+TEST(MultiReplacer, SameAsRecursiveReplace)
+{
+    MultiReplacer replacer{{{"//", "/"}}};
+    std::string s = "a///////b//c/d//e////";
+    replacer.ReplaceInPlace(s);
+    EXPECT_EQ("a/b/c/d/e/", s);
+
+    MultiReplacer eraser{{{"//", ""}}};
+    ASSERT_EQ("a/bc/de", eraser.Replace("a///////b//c/d//e////"));
+}
+
+TEST(MultiReplacer, SinglePass)
+{
+    MultiReplacer replacer{{{"//", "/"}}, MultiReplaceMode::SinglePass};
+    EXPECT_EQ(MultiReplaceMode::SinglePass, replacer.GetMode());
+    EXPECT_EQ("a////b/c/d/e//", replacer.Replace("a///////b//c/d//e////"));
+
+    //'' replaced text is not scanned again, so rules can swap.
+    MultiReplacer swapper{{{"a", "b"}, {"b", "a"}}, MultiReplaceMode::SinglePass};
+    ASSERT_EQ("baab", swapper.Replace("abba"));
+}
+
+TEST(MultiReplacer, MultipleRules)
+{
+    MultiReplacer replacer{{{"//", "/"}, {"\\", "/"}}};
+    EXPECT_EQ("a/b/c", replacer.Replace("a\\\\b//c"));
+
+    MultiReplacer chain{{{"ab", "c"}, {"cc", "d"}}};
+    ASSERT_EQ("dx", chain.Replace("ababx"));
+}
+
+TEST(MultiReplacer, LeftmostLongest)
+{
+    MultiReplacer replacer{{{"he", "1"}, {"hers", "2"}, {"she", "3"}, {"his", "4"}}, MultiReplaceMode::SinglePass};
+    EXPECT_EQ("u3rs", replacer.Replace("ushers"));
+    EXPECT_EQ("2 1r 4", replacer.Replace("hers her his"));
+
+    MultiReplacer prefix{{{"abcd", "X"}, {"bc", "Y"}, {"ab", "Z"}}, MultiReplaceMode::SinglePass};
+    EXPECT_EQ("X", prefix.Replace("abcd"));
+    EXPECT_EQ("Zce", prefix.Replace("abce"));
+    ASSERT_EQ("xYe", prefix.Replace("xbce"));
+}
+
+TEST(MultiReplacer, AllBytes)
+{
+    std::string allBytes;
+    for (int c = 2; c<256; ++c)
+    {
+        allBytes += static_cast<char>(c);
+    }
+    allBytes += '\0';
+    MultiReplacer replacer{{{allBytes, "ALL"}, {"\x01\x01", "ONES"}}, MultiReplaceMode::SinglePass};
+    EXPECT_EQ("\x02\x02", replacer.Replace("\x02\x02"));
+    EXPECT_EQ("ONES", replacer.Replace("\x01\x01"));
+    EXPECT_EQ("xALLy", replacer.Replace("x"+allBytes+"y"));
+    ASSERT_EQ(std::string(1, '\0')+"ONES", replacer.Replace(std::string(1, '\0')+"\x01\x01"));
+}
+
+TEST(MultiReplacer, DuplicateFrom)
+{
+    MultiReplacer replacer{{{"a", "1"}, {"a", "2"}}};
+    ASSERT_EQ("1b1", replacer.Replace("aba"));
+}
+
+TEST(MultiReplacer, NeverFixedPoint)
+{
+    EXPECT_ANY_THROW(
+        MultiReplacer(ReplaceRuleList{{"/", "//"}});
+    );
+    ASSERT_NO_THROW(
+        MultiReplacer(ReplaceRuleList{{"/", "//"}}, MultiReplaceMode::SinglePass);
+    );
+}
+
+TEST(MultiReplacer, RandomRules)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> charDistribution{0, 2};
+    std::uniform_int_distribution<std::size_t> sizeDistribution{0, 40};
+    auto makeString = [&](std::size_t size)
+    {
+        std::string s;
+        for (std::size_t i = 0; i<size; ++i)
+        {
+            s += static_cast<char>('a'+charDistribution(generator));
+        }
+        return s;
+    };
+
+    for (int round = 0; round<1000; ++round)
+    {
+        ReplaceRuleList rules;
+        for (int rule = 0; rule<3; ++rule)
+        {
+            auto from = makeString(1+sizeDistribution(generator)%4);
+            auto to = makeString(sizeDistribution(generator)%from.size());
+            rules.emplace_back(from, to);
+        }
+        auto input = makeString(sizeDistribution(generator));
+
+        std::string expect;
+        auto isReplaced = NaiveReplacePass(rules, input, expect);
+        ASSERT_EQ(expect, MultiReplacer(rules, MultiReplaceMode::SinglePass).Replace(input)) << input;
+
+        //'' shrinking rules always reach fixed point.
+        while (isReplaced)
+        {
+            std::string next;
+            isReplaced = NaiveReplacePass(rules, expect, next);
+            expect.swap(next);
+        }
+        ASSERT_EQ(expect, MultiReplacer(rules).Replace(input)) << input;
+    }
+}
+
+}
@@ -1,19 +1,217 @@
 #include "ies/String/RecursiveReplace.hpp"
 
-namespace ies
+#include <cstring>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+
+#include "ies/String/SubstringSearcher.hpp"
+
+namespace
 {
 
+constexpr auto NotFound = std::string_view::npos;
+
+//! @brief Write side of replacement when result is built in place of source (result never longer than read part).
+class InPlaceWriter
+{
+public:
+        explicit InPlaceWriter(std::string &s)
+        :   mString(s)
+        {}
+
+        char*
+        GetData()
+        {
+            return mString.data();
+        }
+
+        std::size_t
+        GetSize()
+        const
+        {
+            return mSize;
+        }
+
+        void
+        Append(const char* text, std::size_t size)
+        {
+            //'' text can overlap write position when nothing is replaced yet.
+            if (text!=mString.data()+mSize)
+            {
+                std::memmove(mString.data()+mSize, text, size);
+            }
+            mSize += size;
+        }
+
+        void
+        Truncate(std::size_t size)
+        {
+            mSize = size;
+        }
+
+        void
+        Finish()
+        {
+            mString.resize(mSize);
+        }
+
+private:
+    std::string &mString;
+    std::size_t mSize{0};
+};
+
+//! @brief Write side of replacement when result is built in new buffer, then swapped to source.
+class BufferWriter
+{
+public:
+        explicit BufferWriter(std::string &s)
+        :   mString(s)
+        {
+            mBuffer.reserve(s.size());
+        }
+
+        char*
+        GetData()
+        {
+            return mBuffer.data();
+        }
+
+        std::size_t
+        GetSize()
+        const
+        {
+            return mBuffer.size();
+        }
+
+        void
+        Append(const char* text, std::size_t size)
+        {
+            mBuffer.append(text, size);
+        }
+
+        void
+        Truncate(std::size_t size)
+        {
+            mBuffer.resize(size);
+        }
+
+        void
+        Finish()
+        {
+            mString.swap(mBuffer);
+        }
+
+private:
+    std::string &mString;
+    std::string mBuffer;
+};
+
+//! @brief Replace [from] in [s] to [to] in one left to right sweep.
+//! Current string is always written part (writer) + unread part s[read, end).
+//! If [isRecursive], search continues from position of last replacement, as s.replace/s.find loop does.
+//! Only occurrences starting in pending part (last replaced [to]) can cross into unread part,
+//! they are checked before searching unread part.
+template <typename Writer>
 void
-RecursiveReplace(std::string &s, const std::string &from, const std::string &to)
+ReplaceBySweep(std::string &s, std::string_view from, std::string_view to, bool isRecursive)
 {
-    if (!from.empty())
+    Writer writer{s};
+    ies::SubstringSearcher searcher{from};
+    const auto* source = s.data();
+    auto size = s.size();
+    std::size_t read = 0;
+    //'' begin of pending part in written part.
+    auto pending = writer.GetSize();
+
+    auto matchPending = [&](std::size_t begin)
+    {
+        auto writtenSize = writer.GetSize()-begin;
+        auto unreadSize = from.size()-writtenSize;
+        return read+unreadSize<=size
+            && std::memcmp(writer.GetData()+begin, from.data(), writtenSize)==0
+            && std::memcmp(source+read, from.data()+writtenSize, unreadSize)==0;
+    };
+
+    while (true)
     {
-        size_t pos = 0;
-        while (pos = s.find(from, pos), pos!=std::string::npos)
+        std::size_t matchBegin = NotFound;
+        //'' occurrence inside written part only is impossible, since [to] not containing [from] is checked.
+        auto pendingBegin = std::max(pending, writer.GetSize()+1-std::min(writer.GetSize()+1, from.size()));
+        for (auto begin = pendingBegin; begin<writer.GetSize(); ++begin)
+        {
+            if (matchPending(begin))
+            {
+                matchBegin = begin;
+                break;
+            }
+        }
+
+        if (matchBegin!=NotFound)
+        {
+            read += from.size()-(writer.GetSize()-matchBegin);
+            writer.Truncate(matchBegin);
+        }
+        else
         {
-            s.replace(pos, from.size(), to);
+            auto found = searcher.Find(std::string_view{source+read, size-read});
+            if (found==NotFound)
+            {
+                break;
+            }
+            writer.Append(source+read, found);
+            read += found+from.size();
         }
+
+        pending = writer.GetSize();
+        writer.Append(to.data(), to.size());
+        if (!isRecursive)
+        {
+            pending = writer.GetSize();
+        }
+    }
+
+    writer.Append(source+read, size-read);
+    writer.Finish();
+}
+
+void
+Replace(std::string &s, const std::string &from, const std::string &to, bool isRecursive)
+{
+    if (from.empty())
+    {
+        return;
     }
+    if (to.size()<=from.size())
+    {
+        ReplaceBySweep<InPlaceWriter>(s, from, to, isRecursive);
+    }
+    else
+    {
+        ReplaceBySweep<BufferWriter>(s, from, to, isRecursive);
+    }
+}
+
+}
+
+namespace ies
+{
+
+void
+RecursiveReplace(std::string &s, const std::string &from, const std::string &to)
+{
+    if (!from.empty() && to.find(from)!=std::string::npos && s.find(from)!=std::string::npos)
+    {
+        throw std::runtime_error("RecursiveReplace: replace ["+from+"] to ["+to+"] never ends.");
+    }
+    Replace(s, from, to, true);
+}
+
+void
+ReplaceAll(std::string &s, const std::string &from, const std::string &to)
+{
+    Replace(s, from, to, false);
 }
 
 }
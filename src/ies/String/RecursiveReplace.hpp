@@ -8,6 +8,11 @@ namespace ies
 {
 
 //! @brief Recursively replace all occurence of [from] in string [s] to [to] until no occurence.
+//! After each replacement, search continues from position of replaced text,
+//! so occurence formed with replaced text and following text is also replaced.
+//! @note Runs in one sweep with read/write cursors: in place when [to] is not longer than [from],
+//! otherwise into one new buffer. Result is same as repeating s.find(from, pos) and s.replace(pos, ...).
+//! @throw std::runtime_error if [to] contains [from] and [s] contains [from], since replacement never ends.
 //! @example
 //!     std::string s = "a///////b//c/d//e////";
 //!     RecursiveReplace(s, "//", "/");
@@ -16,4 +21,13 @@ IES_EXPORT
 void
 RecursiveReplace(std::string &s, const std::string &from, const std::string &to);
 
+//! @brief Replace all occurence of [from] in string [s] to [to], replaced text is not searched again.
+//! @example
+//!     std::string s = "a///////b//c/d//e////";
+//!     ReplaceAll(s, "//", "/");
+//!     ASSERT_EQ("a////b/c/d/e//", s);
+IES_EXPORT
+void
+ReplaceAll(std::string &s, const std::string &from, const std::string &to);
+
 }
@@ -3,10 +3,31 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <random>
 
 namespace ies
 {
 
+namespace
+{
+
+//'' reference of previous RecursiveReplace implementation.
+void
+ReplaceByStdString(std::string &s, const std::string &from, const std::string &to, bool isRecursive)
+{
+    std::size_t pos = 0;
+    while (pos = s.find(from, pos), pos!=std::string::npos)
+    {
+        s.replace(pos, from.size(), to);
+        if (!isRecursive)
+        {
+            pos += to.size();
+        }
+    }
+}
+
+}
+
 TEST(RecursiveReplace, Empty)
 {
     std::string s;
@@ -35,4 +56,86 @@ TEST(RecursiveReplace, RecursiveReplace)
     ASSERT_EQ("a/b/c/d/e/", s);
 }
 
+TEST(RecursiveReplace, ReplaceAll)
+{
+    std::string s = "a///////b//c/d//e////";
+    ReplaceAll(s, "//", "/");
+    EXPECT_EQ("a////b/c/d/e//", s);
+
+    ReplaceAll(s, "/", "//");
+    EXPECT_EQ("a////////b//c//d//e////", s);
+
+    ReplaceAll(s, "", "/");
+    ASSERT_EQ("a////////b//c//d//e////", s);
+}
+
+TEST(RecursiveReplace, ReplaceAcrossReplaced)
+{
+    std::string s = "aabcc";
+    RecursiveReplace(s, "abc", "b");
+    EXPECT_EQ("abc", s);
+
+    s = "xaaabbb";
+    RecursiveReplace(s, "ab", "");
+    EXPECT_EQ("xaabb", s);
+
+    s = "aab";
+    RecursiveReplace(s, "ab", "xa");
+    ASSERT_EQ("axa", s);
+}
+
+TEST(RecursiveReplace, NeverEnds)
+{
+    std::string s = "a/b";
+    EXPECT_ANY_THROW(
+        RecursiveReplace(s, "/", "//");
+    );
+    EXPECT_ANY_THROW(
+        RecursiveReplace(s, "/", "/");
+    );
+
+    s = "ab";
+    RecursiveReplace(s, "/", "//");
+    ASSERT_EQ("ab", s);
+}
+
+TEST(RecursiveReplace, SameAsStdStringReplace)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> charDistribution{0, 2};
+    std::uniform_int_distribution<std::size_t> sizeDistribution{0, 100};
+    auto makeString = [&](std::size_t size)
+    {
+        std::string s;
+        for (std::size_t i = 0; i<size; ++i)
+        {
+            s += static_cast<char>('a'+charDistribution(generator));
+        }
+        return s;
+    };
+
+    for (int round = 0; round<3000; ++round)
+    {
+        auto from = makeString(1+sizeDistribution(generator)%5);
+        auto to = makeString(sizeDistribution(generator)%7);
+        auto input = makeString(sizeDistribution(generator));
+
+        auto expectAll = input;
+        ReplaceByStdString(expectAll, from, to, false);
+        auto s = input;
+        ReplaceAll(s, from, to);
+        ASSERT_EQ(expectAll, s) << input << " [" << from << "] => [" << to << "]";
+
+        if (to.find(from)!=std::string::npos)
+        {
+            continue;
+        }
+        auto expect = input;
+        ReplaceByStdString(expect, from, to, true);
+        s = input;
+        RecursiveReplace(s, from, to);
+        ASSERT_EQ(expect, s) << input << " [" << from << "] => [" << to << "]";
+    }
+}
+
 }
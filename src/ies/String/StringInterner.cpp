@@ -0,0 +1,333 @@
+#include "ies/String/StringInterner.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ies
+{
+
+namespace
+{
+
+//'' symbol id = ((index in shard)+1)<<ShardBits | shard, id 0 is empty string.
+constexpr std::uint32_t ShardBits = 4;
+constexpr std::uint32_t ShardCount = 1u<<ShardBits;
+constexpr std::uint32_t MaxShardSize = (1u<<(32-ShardBits))-1;
+
+//'' entries of a shard are in segments of doubling size, segment s has 2^(FirstSegmentBits+s) entries.
+//'' entries never move, so readers only need segment pointer.
+constexpr std::uint32_t FirstSegmentBits = 8;
+constexpr std::uint32_t SegmentCount = 32-ShardBits-FirstSegmentBits+1;
+
+struct SegmentPosition
+{
+    std::uint32_t Segment;
+    std::uint32_t Offset;
+};
+
+SegmentPosition
+GetSegmentPosition(std::uint32_t index)
+{
+    auto segment = static_cast<std::uint32_t>(std::bit_width((index>>FirstSegmentBits)+1))-1;
+    return {segment, index-(((1u<<segment)-1)<<FirstSegmentBits)};
+}
+
+constexpr std::size_t PageSize = 64*1024;
+//'' larger strings get own page to not waste rest of current page.
+constexpr std::size_t MaxSizeInSharedPage = PageSize/8;
+
+constexpr std::size_t InitialTableSize = 64;
+
+std::uint64_t
+HashString(std::string_view str)
+{
+    //'' std::hash may be identity-like in low bits, mix so shard and slot bits are both usable.
+    auto hash = static_cast<std::uint64_t>(std::hash<std::string_view>{}(str));
+    hash ^= hash>>31;
+    hash *= 0x9E3779B97F4A7C15ull;
+    return hash^(hash>>29);
+}
+
+std::uint32_t
+GetShardIndex(std::uint64_t hash)
+{
+    return static_cast<std::uint32_t>(hash>>(64-ShardBits));
+}
+
+std::uint32_t
+GetTag(std::uint64_t hash)
+{
+    return static_cast<std::uint32_t>(hash>>32);
+}
+
+//'' open addressing table of slots {tag, index+1}, 0 is empty slot.
+struct Table
+{
+    std::size_t Mask;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> Slots;
+
+        explicit Table(std::size_t size)
+        :   Mask(size-1),
+            Slots(new std::atomic<std::uint64_t>[size])
+        {
+            for (std::size_t i = 0; i<size; ++i)
+            {
+                Slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
+};
+
+}
+
+struct alignas(64) StringInterner::Shard
+{
+    //'' read without lock.
+    std::atomic<Table*> CurrentTable{nullptr};
+    std::atomic<std::uint32_t> Size{0};
+    std::array<std::atomic<std::string_view*>, SegmentCount> Segments{};
+
+    //'' only accessed with Mutex locked.
+    std::mutex Mutex;
+    //'' old tables are kept since lock-free readers may still use them, total is less than 2x current table.
+    std::vector<std::unique_ptr<Table>> Tables;
+    std::vector<std::unique_ptr<std::string_view[]>> SegmentStorages;
+    std::vector<std::uint64_t> Hashes;
+    std::vector<std::unique_ptr<char[]>> Pages;
+    char* PageCursor{nullptr};
+    std::size_t PageRemainSize{0};
+
+        std::string_view
+        GetEntry(std::uint32_t index)
+        const
+        {
+            auto [segment, offset] = GetSegmentPosition(index);
+            return Segments[segment].load(std::memory_order_acquire)[offset];
+        }
+
+        std::optional<std::uint32_t>
+        FindIndex(const Table &table, std::string_view str, std::uint64_t hash)
+        const
+        {
+            auto tag = GetTag(hash);
+            for (auto i = static_cast<std::size_t>(hash)&table.Mask;; i = (i+1)&table.Mask)
+            {
+                auto slot = table.Slots[i].load(std::memory_order_acquire);
+                if (slot==0)
+                {
+                    return std::nullopt;
+                }
+                if (static_cast<std::uint32_t>(slot>>32)==tag)
+                {
+                    auto index = static_cast<std::uint32_t>(slot)-1;
+                    if (GetEntry(index)==str)
+                    {
+                        return index;
+                    }
+                }
+            }
+        }
+
+        static
+        void
+        InsertSlot(Table &table, std::uint32_t index, std::uint64_t hash)
+        {
+            auto i = static_cast<std::size_t>(hash)&table.Mask;
+            while (table.Slots[i].load(std::memory_order_relaxed)!=0)
+            {
+                i = (i+1)&table.Mask;
+            }
+            auto slot = (std::uint64_t{GetTag(hash)}<<32)|(index+1);
+            table.Slots[i].store(slot, std::memory_order_release);
+        }
+
+        const char*
+        CopyToArena(std::string_view str)
+        {
+            auto size = str.size()+1;
+            char* data = nullptr;
+            if (size>MaxSizeInSharedPage)
+            {
+                Pages.emplace_back(new char[size]);
+                data = Pages.back().get();
+            }
+            else
+            {
+                if (size>PageRemainSize)
+                {
+                    Pages.emplace_back(new char[PageSize]);
+                    PageCursor = Pages.back().get();
+                    PageRemainSize = PageSize;
+                }
+                data = PageCursor;
+                PageCursor += size;
+                PageRemainSize -= size;
+            }
+            std::memcpy(data, str.data(), str.size());
+            data[str.size()] = '\0';
+            return data;
+        }
+
+        std::uint32_t
+        Insert(std::string_view str, std::uint64_t hash)
+        {
+            auto index = Size.load(std::memory_order_relaxed);
+            if (index>=MaxShardSize)
+            {
+                throw std::runtime_error("StringInterner::Intern: shard is full.");
+            }
+
+            auto* table = CurrentTable.load(std::memory_order_relaxed);
+            if (!table || (index+1)*2>table->Mask+1)
+            {
+                auto tableSize = table ? (table->Mask+1)*2 : InitialTableSize;
+                Tables.emplace_back(std::make_unique<Table>(tableSize));
+                table = Tables.back().get();
+                for (std::uint32_t i = 0; i<index; ++i)
+                {
+                    InsertSlot(*table, i, Hashes[i]);
+                }
+            }
+
+            auto [segment, offset] = GetSegmentPosition(index);
+            if (offset==0)
+            {
+                SegmentStorages.emplace_back(new std::string_view[std::size_t{1}<<(segment+FirstSegmentBits)]);
+                Segments[segment].store(SegmentStorages.back().get(), std::memory_order_release);
+            }
+            auto* entries = Segments[segment].load(std::memory_order_relaxed);
+            entries[offset] = std::string_view{CopyToArena(str), str.size()};
+            Hashes.emplace_back(hash);
+
+            //'' entry is written before it is reachable from table slot or Size.
+            InsertSlot(*table, index, hash);
+            CurrentTable.store(table, std::memory_order_release);
+            Size.store(index+1, std::memory_order_release);
+            return index;
+        }
+};
+
+namespace
+{
+
+Symbol
+MakeSymbol(std::uint32_t shardIndex, std::uint32_t index)
+{
+    return Symbol{((index+1)<<ShardBits)|shardIndex};
+}
+
+}
+
+StringInterner::
+StringInterner()
+:   mShards(new Shard[ShardCount])
+{
+}
+
+StringInterner::
+~StringInterner() = default;
+
+StringInterner &
+StringInterner::
+GetGlobal()
+{
+    static StringInterner interner;
+    return interner;
+}
+
+Symbol
+StringInterner::
+Intern(std::string_view str)
+{
+    if (str.empty())
+    {
+        return Symbol{};
+    }
+
+    auto hash = HashString(str);
+    auto shardIndex = GetShardIndex(hash);
+    auto &shard = mShards[shardIndex];
+
+    if (auto* table = shard.CurrentTable.load(std::memory_order_acquire))
+    {
+        if (auto index = shard.FindIndex(*table, str, hash))
+        {
+            return MakeSymbol(shardIndex, *index);
+        }
+    }
+
+    std::lock_guard lock{shard.Mutex};
+    //'' may be inserted by other thread before lock.
+    if (auto* table = shard.CurrentTable.load(std::memory_order_relaxed))
+    {
+        if (auto index = shard.FindIndex(*table, str, hash))
+        {
+            return MakeSymbol(shardIndex, *index);
+        }
+    }
+    return MakeSymbol(shardIndex, shard.Insert(str, hash));
+}
+
+std::optional<Symbol>
+StringInterner::
+Find(std::string_view str)
+const
+{
+    if (str.empty())
+    {
+        return Symbol{};
+    }
+
+    auto hash = HashString(str);
+    auto shardIndex = GetShardIndex(hash);
+    auto &shard = mShards[shardIndex];
+    auto* table = shard.CurrentTable.load(std::memory_order_acquire);
+    if (!table)
+    {
+        return std::nullopt;
+    }
+    if (auto index = shard.FindIndex(*table, str, hash))
+    {
+        return MakeSymbol(shardIndex, *index);
+    }
+    return std::nullopt;
+}
+
+std::string_view
+StringInterner::
+GetString(Symbol symbol)
+const
+{
+    if (symbol.Id==0)
+    {
+        return {};
+    }
+
+    auto &shard = mShards[symbol.Id&(ShardCount-1)];
+    auto index = (symbol.Id>>ShardBits)-1;
+    if (index>=shard.Size.load(std::memory_order_acquire))
+    {
+        throw std::runtime_error("StringInterner::GetString: symbol ["+std::to_string(symbol.Id)+"] is not interned.");
+    }
+    return shard.GetEntry(index);
+}
+
+std::size_t
+StringInterner::
+GetSize()
+const
+{
+    std::size_t size = 0;
+    for (std::uint32_t i = 0; i<ShardCount; ++i)
+    {
+        size += mShards[i].Size.load(std::memory_order_relaxed);
+    }
+    return size;
+}
+
+}
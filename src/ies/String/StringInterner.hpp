@@ -0,0 +1,106 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace ies
+{
+
+//! @brief 32-bit id of a string interned by StringInterner, default is empty string.
+//! Equality and hash are O(1) on id.
+//! @note Symbols from different StringInterner are not comparable.
+struct Symbol
+{
+    std::uint32_t Id{0};
+
+    bool operator==(const Symbol &other) const { return Id==other.Id; }
+    bool operator!=(const Symbol &other) const { return Id!=other.Id; }
+    //! @brief Order by id (not string order), for ordered containers.
+    bool operator<(const Symbol &other) const { return Id<other.Id; }
+};
+
+//! @brief Map strings to stable Symbol ids, same string always get same Symbol.
+//! Intern() and Find() are thread-safe: table is split into shards by hash,
+//! lookup of existing string is lock-free, only inserting new string locks its shard.
+//! @note String data is copied to arena pages and never moved or freed until interner is destroyed,
+//! so string_view from GetString() is valid (and null-terminated) during lifetime of interner.
+//! @example
+//!     auto &interner = StringInterner::GetGlobal();
+//!     auto symbol = interner.Intern("name");
+//!     symbol==interner.Intern(std::string{"na"}+"me"); //'' true
+//!     interner.GetString(symbol); //'' "name"
+class IES_EXPORT StringInterner
+{
+public:
+        StringInterner();
+        ~StringInterner();
+
+        StringInterner(const StringInterner &) = delete;
+        StringInterner &
+        operator=(const StringInterner &) = delete;
+
+    //! @brief Process-wide interner, e.g. used by NamedObject.
+        static
+        StringInterner &
+        GetGlobal();
+
+    //! @brief Get Symbol of [str], copy it into interner if not interned yet.
+    //! @throw std::runtime_error if shard of [str] is full (2^28-1 strings per shard of 16).
+        Symbol
+        Intern(std::string_view str);
+
+    //! @brief Get Symbol of [str] if it is interned, never inserts.
+        std::optional<Symbol>
+        Find(std::string_view str)
+        const;
+
+    //! @throw std::runtime_error if [symbol] is not from this interner.
+        std::string_view
+        GetString(Symbol symbol)
+        const;
+
+    //! @brief Count of interned non-empty strings.
+        std::size_t
+        GetSize()
+        const;
+
+private:
+    struct Shard;
+    std::unique_ptr<Shard[]> mShards;
+};
+
+}
+
+namespace std
+{
+
+template <>
+struct hash<ies::Symbol>
+{
+    std::size_t operator()(const ies::Symbol &symbol) const noexcept
+    {
+        return std::hash<std::uint32_t>{}(symbol.Id);
+    }
+};
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
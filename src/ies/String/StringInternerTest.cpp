@@ -0,0 +1,128 @@
+#include "ies/String/StringInterner.hpp"
+
+#include "ies/Common/NamedObject.hpp"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace ies
+{
+
+TEST(StringInterner, Intern)
+{
+    StringInterner interner;
+    EXPECT_EQ(0u, interner.GetSize());
+    EXPECT_EQ(Symbol{}, interner.Intern(""));
+    EXPECT_EQ("", interner.GetString(Symbol{}));
+
+    auto abc = interner.Intern("abc");
+    EXPECT_NE(Symbol{}, abc);
+    EXPECT_EQ(abc, interner.Intern(std::string{"ab"}+"c"));
+    EXPECT_NE(abc, interner.Intern("abd"));
+    EXPECT_EQ("abc", interner.GetString(abc));
+    EXPECT_EQ(2u, interner.GetSize());
+
+    std::string withZero{"a\0b", 3};
+    EXPECT_EQ(withZero, interner.GetString(interner.Intern(withZero)));
+    EXPECT_NE(interner.Intern("a"), interner.Intern(withZero));
+
+    EXPECT_EQ(abc, interner.Find("abc"));
+    EXPECT_FALSE(interner.Find("xyz"));
+    EXPECT_EQ(4u, interner.GetSize());
+
+    std::unordered_set<Symbol> symbols{abc, interner.Intern("abc")};
+    EXPECT_EQ(1u, symbols.size());
+
+    StringInterner empty;
+    ASSERT_THROW(empty.GetString(abc), std::runtime_error);
+}
+
+TEST(StringInterner, StableString)
+{
+    StringInterner interner;
+    std::vector<std::string> strings;
+    std::vector<Symbol> symbols;
+    std::vector<const char*> datas;
+    for (std::size_t i = 0; i<50000; ++i)
+    {
+        //'' some strings larger than arena page.
+        auto s = (i%5000==0) ? std::string(70000, 'x')+std::to_string(i) : "s"+std::to_string(i);
+        symbols.emplace_back(interner.Intern(s));
+        datas.emplace_back(interner.GetString(symbols.back()).data());
+        strings.emplace_back(std::move(s));
+    }
+    EXPECT_EQ(strings.size(), interner.GetSize());
+
+    for (std::size_t i = 0; i<strings.size(); ++i)
+    {
+        auto str = interner.GetString(symbols[i]);
+        ASSERT_EQ(strings[i], str);
+        ASSERT_EQ(datas[i], str.data());
+        ASSERT_EQ('\0', str.data()[str.size()]);
+        ASSERT_EQ(symbols[i], interner.Intern(strings[i]));
+    }
+}
+
+TEST(StringInterner, Concurrent)
+{
+    StringInterner interner;
+    constexpr std::size_t ThreadCount = 4;
+    constexpr std::size_t StringCount = 20000;
+    std::vector<std::vector<Symbol>> threadSymbols(ThreadCount);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t<ThreadCount; ++t)
+    {
+        threads.emplace_back([&interner, &symbols = threadSymbols[t], t]
+        {
+            //'' all threads intern same strings in different order, multipliers are coprime to StringCount.
+            constexpr std::size_t Multipliers[ThreadCount]{1, 3, 7, 9};
+            symbols.resize(StringCount);
+            for (std::size_t i = 0; i<StringCount; ++i)
+            {
+                auto k = (i*Multipliers[t]+t*7)%StringCount;
+                symbols[k] = interner.Intern("s"+std::to_string(k));
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(StringCount, interner.GetSize());
+    for (std::size_t t = 1; t<ThreadCount; ++t)
+    {
+        EXPECT_EQ(threadSymbols[0], threadSymbols[t]);
+    }
+    for (std::size_t i = 0; i<StringCount; ++i)
+    {
+        ASSERT_EQ("s"+std::to_string(i), interner.GetString(threadSymbols[0][i]));
+    }
+}
+
+TEST(StringInterner, NamedObject)
+{
+    NamedObject object{"name"};
+    EXPECT_EQ("name", object.GetName());
+    EXPECT_FALSE(object.GetNameSymbol());
+    object.SetName("NamedObject name is not interned");
+    EXPECT_FALSE(StringInterner::GetGlobal().Find(object.GetName()));
+    object.SetName("name");
+    EXPECT_EQ("NamedObject[name]", ToString(object));
+
+    auto other = StringInterner::GetGlobal().Intern("other");
+    object.SetName(other);
+    EXPECT_EQ("other", object.GetName());
+    EXPECT_EQ(other, object.GetNameSymbol());
+    EXPECT_EQ(other, NamedObject{other}.GetNameSymbol());
+    object.SetName("");
+    EXPECT_EQ("", object.GetName());
+    ASSERT_FALSE(object.GetNameSymbol());
+}
+
+}
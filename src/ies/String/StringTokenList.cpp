@@ -0,0 +1,98 @@
+#include "ies/String/StringTokenList.hpp"
+
+#include <cstring>
+
+#include "ies/String/SplitStringView.hpp"
+
+namespace ies
+{
+
+StringTokenList::
+StringTokenList(std::string_view input)
+:   mBuffer(std::make_unique<char[]>(input.size()))
+{
+    if (!input.empty())
+    {
+        std::memcpy(mBuffer.get(), input.data(), input.size());
+    }
+}
+
+StringTokenList::
+StringTokenList(const StringTokenList &rhs)
+{
+    *this = rhs;
+}
+
+StringTokenList &
+StringTokenList::
+operator=(const StringTokenList &rhs)
+{
+    if (this==&rhs) { return *this; }
+
+    //'' tokens are in buffer order, so buffer size to copy is end of last token.
+    std::size_t bufferSize = 0;
+    if (!rhs.mTokens.empty())
+    {
+        auto &last = rhs.mTokens.back();
+        bufferSize = static_cast<std::size_t>(last.data()-rhs.mBuffer.get())+last.size();
+    }
+
+    mBuffer = std::make_unique<char[]>(bufferSize);
+    if (bufferSize!=0)
+    {
+        std::memcpy(mBuffer.get(), rhs.mBuffer.get(), bufferSize);
+    }
+
+    mTokens.clear();
+    mTokens.reserve(rhs.mTokens.size());
+    for (auto token : rhs.mTokens)
+    {
+        auto offset = static_cast<std::size_t>(token.data()-rhs.mBuffer.get());
+        mTokens.emplace_back(mBuffer.get()+offset, token.size());
+    }
+    return *this;
+}
+
+const std::vector<std::string_view> &
+StringTokenList::
+GetTokens()
+const
+{
+    return mTokens;
+}
+
+std::vector<std::string>
+StringTokenList::
+ToStringVector()
+const
+{
+    std::vector<std::string> tokens;
+    tokens.reserve(mTokens.size());
+    for (auto token : mTokens)
+    {
+        tokens.emplace_back(token);
+    }
+    return tokens;
+}
+
+StringTokenList
+SplitStringTokenList(std::string_view separators,
+                     std::string_view input,
+                     std::size_t reserveHint)
+{
+    StringTokenList tokenList{input};
+    tokenList.mTokens = SplitStringView(separators, {tokenList.mBuffer.get(), input.size()}, reserveHint);
+    return tokenList;
+}
+
+StringTokenList
+SplitStringTokenListPreserve(std::string_view separators,
+                             std::string_view input,
+                             std::size_t reserveHint)
+{
+    StringTokenList tokenList{input};
+    tokenList.mTokens = SplitStringViewPreserve(separators, {tokenList.mBuffer.get(), input.size()}, reserveHint);
+    return tokenList;
+}
+
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ies
+{
+
+//! @brief Owning list of string tokens, result of SplitStringTokenList[Preserve].
+//! Input is copied once into a single owned buffer and tokens are string_views into that buffer,
+//! so a split costs two allocations (buffer and token vector) regardless of token count and length.
+//! @note Token views stay valid as long as the StringTokenList (or a moved-to StringTokenList) is alive.
+//! Copying StringTokenList copies the buffer and rebinds token views to the new buffer.
+//! @note Provides read-only vector-like access: size(), empty(), operator[], at(), front(), back(), begin(), end().
+class IES_EXPORT StringTokenList
+{
+public:
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+    using const_iterator = std::vector<std::string_view>::const_iterator;
+
+        StringTokenList() = default;
+        ~StringTokenList() = default;
+
+        StringTokenList(const StringTokenList &rhs);
+
+        StringTokenList &
+        operator=(const StringTokenList &rhs);
+
+        StringTokenList(StringTokenList &&rhs) noexcept = default;
+
+        StringTokenList &
+        operator=(StringTokenList &&rhs) noexcept = default;
+
+        std::size_t size() const { return mTokens.size(); }
+        bool empty() const { return mTokens.empty(); }
+
+        std::string_view operator[](std::size_t i) const { return mTokens[i]; }
+
+    //! @brief Bounds checked access, throws std::out_of_range same as std::vector::at().
+        std::string_view at(std::size_t i) const { return mTokens.at(i); }
+
+        std::string_view front() const { return mTokens.front(); }
+        std::string_view back() const { return mTokens.back(); }
+
+        const_iterator begin() const { return mTokens.begin(); }
+        const_iterator end() const { return mTokens.end(); }
+
+    //! @brief Get token views, valid as long as this StringTokenList is alive.
+        const std::vector<std::string_view> &
+        GetTokens()
+        const;
+
+    //! @brief Copy tokens to owned std::vector<std::string>, reserved to exact token count.
+        std::vector<std::string>
+        ToStringVector()
+        const;
+
+private:
+    std::unique_ptr<char[]> mBuffer;
+    std::vector<std::string_view> mTokens;
+
+        explicit StringTokenList(std::string_view input);
+
+    friend IES_EXPORT StringTokenList SplitStringTokenList(std::string_view, std::string_view, std::size_t);
+    friend IES_EXPORT StringTokenList SplitStringTokenListPreserve(std::string_view, std::string_view, std::size_t);
+};
+
+//! @brief Split string [input] to tokens separated by any char of [separators], empty token will be ignored.
+//! Same result as SplitString() but tokens are owned by one buffer in StringTokenList.
+//! @example SplitStringTokenList(",", "a,,b,c,") => StringTokenList{"a", "b", "c"}.
+//! @note Use when tokens need to outlive [input] and SplitString's per-token allocation matters.
+//! @note Use [reserveHint] to reduce allocation if can estimate size of tokens.
+IES_EXPORT
+StringTokenList
+SplitStringTokenList(std::string_view separators,
+                     std::string_view input,
+                     std::size_t reserveHint=4);
+
+//! @brief Split string [input] to tokens separated by any char of [separators], empty token is preserved.
+//! Same result as SplitStringPreserve() but tokens are owned by one buffer in StringTokenList.
+//! @example SplitStringTokenListPreserve(",", "a,,b,c,") => StringTokenList{"a", "", "b", "c", ""}.
+//! @note Use reserveHint to reduce allocation if can estimate size of tokens.
+IES_EXPORT
+StringTokenList
+SplitStringTokenListPreserve(std::string_view separators,
+                             std::string_view input,
+                             std::size_t reserveHint=4);
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
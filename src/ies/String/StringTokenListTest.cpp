@@ -0,0 +1,81 @@
+#include "ies/String/StringTokenList.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <utility>
+
+#include "ies/String/SplitString.hpp"
+
+namespace ies
+{
+
+TEST(StringTokenList, EmptyString)
+{
+    auto tokens = SplitStringTokenList("", "");
+    ASSERT_TRUE(tokens.empty());
+}
+
+TEST(StringTokenList, SplitStringTokenList)
+{
+    auto tokens = SplitStringTokenList("() ,", "(x,y), ,(a b)");
+
+    ASSERT_EQ(4u, tokens.size());
+    EXPECT_EQ("x", tokens[0]);
+    EXPECT_EQ("y", tokens[1]);
+    EXPECT_EQ("a", tokens.at(2));
+    EXPECT_EQ("b", tokens.back());
+    ASSERT_ANY_THROW(
+        (void)tokens.at(4);
+    );
+}
+
+TEST(StringTokenList, OutliveInput)
+{
+    StringTokenList tokens;
+    {
+        std::string input = "a long token that does not fit in small string buffer,b,,c";
+        tokens = SplitStringTokenList(",", input);
+        input.assign(input.size(), '#');
+    }
+
+    ASSERT_EQ(3u, tokens.size());
+    EXPECT_EQ("a long token that does not fit in small string buffer", tokens[0]);
+    EXPECT_EQ("b", tokens[1]);
+    ASSERT_EQ("c", tokens[2]);
+}
+
+TEST(StringTokenList, PreserveEmpty)
+{
+    auto tokens = SplitStringTokenListPreserve(",", ",,b,,,e,,", 8);
+
+    std::vector<std::string> expectTokens{"", "", "b", "", "", "e", "", ""};
+    ASSERT_EQ(expectTokens, tokens.ToStringVector());
+}
+
+TEST(StringTokenList, SameAsSplitString)
+{
+    std::string separators = "() ,";
+    std::string input = " ! ( 9, j,a s,ijd, (,)(*^*&sdf98sd9fjs8,99ki20qv3q'09923,842djfojn23j4),,,";
+
+    EXPECT_EQ(SplitString(separators, input), SplitStringTokenList(separators, input).ToStringVector());
+    ASSERT_EQ(SplitStringPreserve(separators, input), SplitStringTokenListPreserve(separators, input).ToStringVector());
+}
+
+TEST(StringTokenList, CopyAndMove)
+{
+    auto tokens = SplitStringTokenList(",", "alpha,beta,gamma");
+
+    auto copy = tokens;
+    ASSERT_EQ(tokens.ToStringVector(), copy.ToStringVector());
+    EXPECT_NE(tokens[0].data(), copy[0].data());
+
+    auto* data = tokens[1].data();
+    auto moved = std::move(tokens);
+    EXPECT_EQ(data, moved[1].data());
+
+    std::vector<std::string> expectTokens{"alpha", "beta", "gamma"};
+    ASSERT_EQ(expectTokens, moved.ToStringVector());
+}
+
+}
@@ -0,0 +1,322 @@
+#include "ies/String/SubstringSearcher.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#include "ies/Common/Simd.hpp"
+
+#if IES_SIMD_AVX2
+#include <immintrin.h>
+#elif IES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+
+constexpr auto NotFound = std::string_view::npos;
+
+using TwoWayFactorization = ies::SubstringSearcher::TwoWayFactorization;
+
+ies::SubstringSearchAlgorithm
+SelectAlgorithm(std::size_t needleSize)
+{
+    if (needleSize==0)
+    {
+        return ies::SubstringSearchAlgorithm::Empty;
+    }
+    if (needleSize==1)
+    {
+        return ies::SubstringSearchAlgorithm::Char;
+    }
+    if (needleSize<=ies::SubstringSearcher::MaxFirstLastFilterSize)
+    {
+        return ies::SubstringSearchAlgorithm::FirstLastFilter;
+    }
+    return ies::SubstringSearchAlgorithm::TwoWay;
+}
+
+std::size_t
+FindChar(std::string_view haystack, char c, std::size_t pos)
+{
+    const auto* data = haystack.data();
+    const auto* found = static_cast<const char*>(std::memchr(data+pos, c, haystack.size()-pos));
+    return found ? static_cast<std::size_t>(found-data) : NotFound;
+}
+
+//! @brief Compute maximal suffix of [needle] by byte order (or reversed order), return {suffix begin, period of suffix}.
+std::pair<std::size_t, std::size_t>
+FindMaximalSuffix(std::string_view needle, bool isReversed)
+{
+    auto size = needle.size();
+    //'' suffix begins at maxSuffix+1, maxSuffix starts at -1 (as size_t wraps, +1 gives 0).
+    auto maxSuffix = static_cast<std::size_t>(-1);
+    std::size_t j = 0;
+    std::size_t k = 1;
+    std::size_t period = 1;
+    while (j+k<size)
+    {
+        auto a = static_cast<unsigned char>(needle[j+k]);
+        auto b = static_cast<unsigned char>(needle[maxSuffix+k]);
+        if (isReversed ? a>b : a<b)
+        {
+            j += k;
+            k = 1;
+            period = j-maxSuffix;
+        }
+        else if (a==b)
+        {
+            if (k!=period)
+            {
+                ++k;
+            }
+            else
+            {
+                j += period;
+                k = 1;
+            }
+        }
+        else
+        {
+            maxSuffix = j;
+            j = maxSuffix+1;
+            k = 1;
+            period = 1;
+        }
+    }
+    return {maxSuffix+1, period};
+}
+
+TwoWayFactorization
+FactorizeTwoWay(std::string_view needle)
+{
+    auto [suffix, period] = FindMaximalSuffix(needle, false);
+    auto [reversedSuffix, reversedPeriod] = FindMaximalSuffix(needle, true);
+    if (reversedSuffix>suffix)
+    {
+        suffix = reversedSuffix;
+        period = reversedPeriod;
+    }
+
+    TwoWayFactorization factorization;
+    factorization.Critical = suffix;
+    factorization.IsPeriodic = period+suffix<=needle.size()
+        && std::memcmp(needle.data(), needle.data()+period, suffix)==0;
+    factorization.Period = factorization.IsPeriodic
+        ? period
+        : std::max(suffix, needle.size()-suffix)+1;
+    return factorization;
+}
+
+//! @brief Two-Way string matching, linear time and constant space.
+//! Right part needle[Critical, end) is compared left to right first, then left part right to left.
+std::size_t
+FindByTwoWay(std::string_view haystack, std::string_view needle, const TwoWayFactorization &factorization, std::size_t pos)
+{
+    const auto* data = haystack.data();
+    auto size = haystack.size();
+    auto needleSize = needle.size();
+    auto critical = factorization.Critical;
+    auto period = factorization.Period;
+    //'' prefix needle[0, memory) is known to match when periodic needle shifts by period.
+    std::size_t memory = 0;
+
+    while (pos+needleSize<=size)
+    {
+        const auto* window = data+pos;
+        auto i = std::max(critical, memory);
+        while (i<needleSize && needle[i]==window[i])
+        {
+            ++i;
+        }
+        if (i<needleSize)
+        {
+            pos += i-critical+1;
+            memory = 0;
+            continue;
+        }
+
+        i = critical;
+        while (i>memory && needle[i-1]==window[i-1])
+        {
+            --i;
+        }
+        if (i<=memory)
+        {
+            return pos;
+        }
+        pos += period;
+        memory = factorization.IsPeriodic ? needleSize-period : 0;
+    }
+    return NotFound;
+}
+
+//! @brief Find [needle] (size>=2) by comparing first and last character of needle at a block of positions per step.
+//! If [factorization] is given, switch to Two-Way when full compares are more than one per 16 bytes scanned.
+std::size_t
+FindByFirstLastFilter(std::string_view haystack,
+                      std::string_view needle,
+                      const TwoWayFactorization* factorization,
+                      std::size_t pos)
+{
+    [[maybe_unused]] const auto* data = haystack.data();
+    [[maybe_unused]] auto size = haystack.size();
+    [[maybe_unused]] auto lastOffset = needle.size()-1;
+    [[maybe_unused]] auto begin = pos;
+    [[maybe_unused]] std::size_t compareCount = 0;
+    //'' candidate at p is matched if needle[1, lastOffset) is equal, first and last are checked by mask.
+    [[maybe_unused]] auto isMatch = [&](std::size_t p)
+    {
+        return std::memcmp(data+p+1, needle.data()+1, lastOffset-1)==0;
+    };
+    [[maybe_unused]] auto isTooManyCompare = [&](std::size_t p)
+    {
+        ++compareCount;
+        return factorization && compareCount>8+(p-begin)/16;
+    };
+
+#if IES_SIMD_AVX2
+    auto first = _mm256_set1_epi8(needle.front());
+    auto last = _mm256_set1_epi8(needle.back());
+    for (; pos+lastOffset+32<=size; pos += 32)
+    {
+        auto firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data+pos));
+        auto lastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data+pos+lastOffset));
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, first), _mm256_cmpeq_epi8(lastBlock, last))));
+        while (mask!=0)
+        {
+            auto candidate = pos+static_cast<std::size_t>(std::countr_zero(mask));
+            mask &= mask-1;
+            if (isTooManyCompare(candidate))
+            {
+                return FindByTwoWay(haystack, needle, *factorization, candidate);
+            }
+            if (isMatch(candidate))
+            {
+                return candidate;
+            }
+        }
+    }
+#elif IES_SIMD_SSE2
+    auto first = _mm_set1_epi8(needle.front());
+    auto last = _mm_set1_epi8(needle.back());
+    auto matchMask = [&](std::size_t p)
+    {
+        auto firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data+p));
+        auto lastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data+p+lastOffset));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(firstBlock, first), _mm_cmpeq_epi8(lastBlock, last))));
+    };
+    //'' 2 blocks per step, same step as AVX2.
+    for (; pos+lastOffset+32<=size; pos += 32)
+    {
+        auto mask = matchMask(pos)|(matchMask(pos+16)<<16);
+        while (mask!=0)
+        {
+            auto candidate = pos+static_cast<std::size_t>(std::countr_zero(mask));
+            mask &= mask-1;
+            if (isTooManyCompare(candidate))
+            {
+                return FindByTwoWay(haystack, needle, *factorization, candidate);
+            }
+            if (isMatch(candidate))
+            {
+                return candidate;
+            }
+        }
+    }
+#endif
+    if (factorization)
+    {
+        return FindByTwoWay(haystack, needle, *factorization, pos);
+    }
+    return haystack.find(needle, pos);
+}
+
+}
+
+namespace ies
+{
+
+SubstringSearcher::
+SubstringSearcher(std::string_view needle)
+:   mNeedle(needle),
+    mAlgorithm(SelectAlgorithm(needle.size()))
+{
+    if (mAlgorithm==SubstringSearchAlgorithm::TwoWay)
+    {
+        mFactorization = FactorizeTwoWay(mNeedle);
+    }
+}
+
+std::size_t
+SubstringSearcher::
+Find(std::string_view haystack, std::size_t pos)
+const
+{
+    if (pos>haystack.size() || mNeedle.size()>haystack.size()-pos)
+    {
+        return NotFound;
+    }
+
+    switch (mAlgorithm)
+    {
+        case SubstringSearchAlgorithm::Empty:
+            return pos;
+        case SubstringSearchAlgorithm::Char:
+            return FindChar(haystack, mNeedle.front(), pos);
+        case SubstringSearchAlgorithm::FirstLastFilter:
+            return FindByFirstLastFilter(haystack, mNeedle, nullptr, pos);
+        case SubstringSearchAlgorithm::TwoWay:
+            return FindByFirstLastFilter(haystack, mNeedle, &mFactorization, pos);
+    }
+    return NotFound;
+}
+
+const std::string &
+SubstringSearcher::
+GetNeedle()
+const
+{
+    return mNeedle;
+}
+
+SubstringSearchAlgorithm
+SubstringSearcher::
+GetAlgorithm()
+const
+{
+    return mAlgorithm;
+}
+
+std::size_t
+FindSubstring(std::string_view haystack, std::string_view needle, std::size_t pos)
+{
+    if (pos>haystack.size() || needle.size()>haystack.size()-pos)
+    {
+        return NotFound;
+    }
+
+    switch (SelectAlgorithm(needle.size()))
+    {
+        case SubstringSearchAlgorithm::Empty:
+            return pos;
+        case SubstringSearchAlgorithm::Char:
+            return FindChar(haystack, needle.front(), pos);
+        case SubstringSearchAlgorithm::FirstLastFilter:
+            return FindByFirstLastFilter(haystack, needle, nullptr, pos);
+        case SubstringSearchAlgorithm::TwoWay:
+        {
+            auto factorization = FactorizeTwoWay(needle);
+            return FindByFirstLastFilter(haystack, needle, &factorization, pos);
+        }
+    }
+    return NotFound;
+}
+
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "ies/StdUtil/RequireCpp17.hpp" // IWYU pragma: keep
+
+//'' workaround for warning C4251: class T needs to have dll-interface to be used by clients of class T.
+//'' just disable warning, not fix it properly currently
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+#include "ies/ies_export.h"
+
+#include <cstddef>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "ies/Common/SmartEnum.hxx"
+
+namespace ies
+{
+
+//! @brief Algorithm used by SubstringSearcher, selected by needle size.
+//! Empty: always found at search position.
+//! Char: single character needle, memchr.
+//! FirstLastFilter: short needle, SIMD compare first and last character of needle at 32 positions per step,
+//!     full compare only positions where both match.
+//! TwoWay: long needle, FirstLastFilter while candidates are sparse,
+//!     switch to Two-Way (Crochemore-Perrin) when full compares become frequent, so worst case is linear.
+//! @note Boyer-Moore-Horspool was measured slower than FirstLastFilter on text for needles up to 4000 bytes,
+//! since text alphabet is small and bad character shift is short, so it is not used.
+IES_SMART_ENUM(SubstringSearchAlgorithm,
+    Empty,
+    Char,
+    FirstLastFilter,
+    TwoWay
+);
+
+//! @brief Precompiled needle for repeated substring search in many or large haystacks.
+//! Result is same as std::string_view::find(needle, pos).
+//! @example
+//!     SubstringSearcher searcher{"needle"};
+//!     for (auto &line : lines)
+//!     {
+//!         if (searcher.Find(line)!=std::string_view::npos) { ... }
+//!     }
+class IES_EXPORT SubstringSearcher
+{
+public:
+    //! @brief Needles longer than this use TwoWay.
+    static constexpr std::size_t MaxFirstLastFilterSize = 32;
+
+    //! @brief Copy [needle] and precompute search tables.
+        explicit SubstringSearcher(std::string_view needle);
+
+    //! @brief Find first needle in [haystack] starting from [pos].
+    //! @return Position of needle, or std::string_view::npos if not found.
+        std::size_t
+        Find(std::string_view haystack, std::size_t pos=0)
+        const;
+
+        const std::string &
+        GetNeedle()
+        const;
+
+        SubstringSearchAlgorithm
+        GetAlgorithm()
+        const;
+
+    //! @brief Critical factorization of needle for Two-Way: needle = u+v, v starts at Critical.
+    struct TwoWayFactorization
+    {
+        std::size_t Critical{0};
+        std::size_t Period{1};
+        bool IsPeriodic{false};
+    };
+
+private:
+    std::string mNeedle;
+    SubstringSearchAlgorithm mAlgorithm;
+    TwoWayFactorization mFactorization;
+};
+
+//! @brief Find first [needle] in [haystack] starting from [pos], same result as std::string_view::find(needle, pos).
+//! Algorithm is selected as SubstringSearcher without keeping tables, use SubstringSearcher for repeated search.
+IES_EXPORT
+std::size_t
+FindSubstring(std::string_view haystack, std::string_view needle, std::size_t pos=0);
+
+//! @brief [String] Same as ies::Find(s, substr) in StdUtil/Find.hxx, but search by FindSubstring.
+//! @note If substr is empty, always return pos=0.
+//! @note Kept out of StdUtil/Find.hxx so StdUtil stays header-only without linking ies.
+[[nodiscard]]
+inline
+std::optional<std::size_t>
+FindString(std::string_view s, std::string_view substr)
+{
+    if (auto pos = FindSubstring(s, substr); pos!=std::string_view::npos)
+    {
+        return {pos};
+    }
+    return std::nullopt;
+}
+
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,127 @@
+#include "ies/String/SubstringSearcher.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+namespace ies
+{
+
+TEST(SubstringSearcher, Algorithm)
+{
+    EXPECT_EQ(SubstringSearchAlgorithm::Empty, SubstringSearcher{""}.GetAlgorithm());
+    EXPECT_EQ(SubstringSearchAlgorithm::Char, SubstringSearcher{"a"}.GetAlgorithm());
+    EXPECT_EQ(SubstringSearchAlgorithm::FirstLastFilter, SubstringSearcher{"ab"}.GetAlgorithm());
+    EXPECT_EQ(SubstringSearchAlgorithm::FirstLastFilter, SubstringSearcher{std::string(32, 'a')}.GetAlgorithm());
+    ASSERT_EQ(SubstringSearchAlgorithm::TwoWay, SubstringSearcher{std::string(33, 'a')}.GetAlgorithm());
+}
+
+TEST(SubstringSearcher, Find)
+{
+    std::string_view haystack = "abcdefabcdef";
+    SubstringSearcher searcher{"cde"};
+    EXPECT_EQ("cde", searcher.GetNeedle());
+    EXPECT_EQ(2u, searcher.Find(haystack));
+    EXPECT_EQ(8u, searcher.Find(haystack, 3));
+    EXPECT_EQ(std::string_view::npos, searcher.Find(haystack, 9));
+    EXPECT_EQ(std::string_view::npos, searcher.Find(haystack, 100));
+
+    EXPECT_EQ(0u, FindSubstring(haystack, ""));
+    EXPECT_EQ(12u, FindSubstring(haystack, "", 12));
+    EXPECT_EQ(std::string_view::npos, FindSubstring(haystack, "", 13));
+    EXPECT_EQ(5u, FindSubstring(haystack, "f"));
+    EXPECT_EQ(std::string_view::npos, FindSubstring(haystack, "abcdefabcdefa"));
+    ASSERT_EQ(std::string_view::npos, FindSubstring("", "a"));
+}
+
+TEST(SubstringSearcher, FindString)
+{
+    EXPECT_EQ(2u, FindString("abcdefabcdef", "cde").value());
+    EXPECT_EQ(0u, FindString("abc", "").value());
+    ASSERT_FALSE(FindString("abc", "abcd"));
+}
+
+TEST(SubstringSearcher, NullCharacter)
+{
+    std::string haystack{"a\0b\0\0c", 6};
+    EXPECT_EQ(3u, FindSubstring(haystack, std::string_view{"\0\0", 2}));
+    ASSERT_EQ(1u, SubstringSearcher(std::string_view{"\0", 1}).Find(haystack));
+}
+
+TEST(SubstringSearcher, DenseCandidates)
+{
+    //'' every position passes first and last character filter.
+    std::string haystack(5000, 'a');
+    auto needle = std::string(40, 'a')+"b"+std::string(40, 'a');
+    EXPECT_EQ(std::string_view::npos, SubstringSearcher{needle}.Find(haystack));
+    haystack += needle;
+    EXPECT_EQ(5000u, SubstringSearcher{needle}.Find(haystack));
+
+    std::string periodic;
+    for (int i = 0; i<30; ++i)
+    {
+        periodic += "ab";
+    }
+    haystack = periodic+periodic+"a"+periodic+"c";
+    ASSERT_EQ(haystack.find(periodic+"c"), SubstringSearcher{periodic+"c"}.Find(haystack));
+}
+
+TEST(SubstringSearcher, SameAsStdFind)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> charDistribution{0, 3};
+    auto makeString = [&](std::size_t size)
+    {
+        std::string s;
+        for (std::size_t i = 0; i<size; ++i)
+        {
+            s += static_cast<char>('a'+charDistribution(generator));
+        }
+        return s;
+    };
+
+    for (std::size_t needleSize : {1u, 2u, 3u, 5u, 16u, 31u, 32u, 33u, 40u, 100u})
+    {
+        for (std::size_t haystackSize : {0u, 10u, 64u, 200u, 5000u})
+        {
+            auto haystack = makeString(haystackSize);
+            for (int round = 0; round<10; ++round)
+            {
+                //'' needle taken from haystack so it is usually found, or random needle.
+                std::string needle;
+                if (round%2==0 && needleSize<=haystackSize)
+                {
+                    auto begin = std::uniform_int_distribution<std::size_t>{0, haystackSize-needleSize}(generator);
+                    needle = haystack.substr(begin, needleSize);
+                }
+                else
+                {
+                    needle = makeString(needleSize);
+                }
+
+                SubstringSearcher searcher{needle};
+                //'' two letters only, for dense candidates and periodic needles.
+                if (round>=6)
+                {
+                    for (auto &c : needle)
+                    {
+                        c = static_cast<char>('a'+(c-'a')%2);
+                    }
+                    for (auto &c : haystack)
+                    {
+                        c = static_cast<char>('a'+(c-'a')%2);
+                    }
+                    searcher = SubstringSearcher{needle};
+                }
+                for (std::size_t pos : {std::size_t{0}, std::size_t{1}, haystackSize/2})
+                {
+                    auto expect = haystack.find(needle, pos);
+                    ASSERT_EQ(expect, searcher.Find(haystack, pos)) << needle;
+                    ASSERT_EQ(expect, FindSubstring(haystack, needle, pos)) << needle;
+                }
+            }
+        }
+    }
+}
+
+}
@@ -1,5 +1,5 @@
 #pragma once
 
-#define IES_VERSION_MAJOR 6
-#define IES_VERSION_MINOR 1
+#define IES_VERSION_MAJOR 7
+#define IES_VERSION_MINOR 0
 #define IES_VERSION_PATCH 0